@@ -33,6 +33,9 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "Adafruit_GFX.h"
 #include "glcdfont.c"
+#ifdef GFX_PROFILE
+#include <stdio.h>
+#endif
 #ifdef __AVR__
 #include <avr/pgmspace.h>
 #elif defined(ESP8266) || defined(ESP32)
@@ -99,6 +102,48 @@ inline uint8_t *pgm_read_bitmap_ptr(const GFXfont *gfxFont) {
   }
 #endif
 
+// Transpose an 8x8 bit block in place: bit (0x80 >> c) of row r moves to bit
+// (0x80 >> r) of row c. From Hacker's Delight, section 7-3.
+static void transpose8(uint8_t block[8]) {
+  uint32_t x = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) |
+               ((uint32_t)block[2] << 8) | block[3];
+  uint32_t y = ((uint32_t)block[4] << 24) | ((uint32_t)block[5] << 16) |
+               ((uint32_t)block[6] << 8) | block[7];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  block[0] = x >> 24;
+  block[1] = x >> 16;
+  block[2] = x >> 8;
+  block[3] = x;
+  block[4] = y >> 24;
+  block[5] = y >> 16;
+  block[6] = y >> 8;
+  block[7] = y;
+}
+
+// Reverse the order of the bits in a word, bit 31 swaps with bit 0
+static uint32_t reverse32(uint32_t x) {
+  x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+  x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+  x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+  x = ((x >> 8) & 0x00FF00FF) | ((x & 0x00FF00FF) << 8);
+  return (x >> 16) | (x << 16);
+}
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX context for graphics! Can only be done by a
@@ -117,6 +162,8 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   wrap = true;
   _cp437 = false;
   gfxFont = NULL;
+  clipDepth = 0;
+  updateClip();
 }
 
 /**************************************************************************/
@@ -188,7 +235,8 @@ void Adafruit_GFX::startWrite() {}
 */
 /**************************************************************************/
 void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t color) {
-  drawPixel(x, y, color);
+  if (clipContains(x, y))
+    drawPixel(x, y, color);
 }
 
 /**************************************************************************/
@@ -244,6 +292,29 @@ void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   fillRect(x, y, w, h, color);
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write up to 32 pixels of one row from a packed mask, the entry
+   point for bitmaps, glyphs and horizontal spans. Pixels of set bits get
+   color, clear bits are left alone. Overwrite in subclasses that can combine
+   the mask with their memory a word at a time, and clip it like writePixel()
+   does.
+    @param    x   Left-most x coordinate
+    @param    y   Row y coordinate
+    @param    w   Width in pixels, 1 to 32
+    @param    mask  Pixel x in bit 31, x + 1 in bit 30 and so on, bits past w
+   are ignored
+   @param    color 16-bit 5-6-5 Color to draw set bits with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeSpanMask(int16_t x, int16_t y, int16_t w,
+                                 uint32_t mask, uint16_t color) {
+  for (int16_t i = 0; (i < w) && mask; i++, mask <<= 1) {
+    if (mask & 0x80000000UL)
+      writePixel(x + i, y, color);
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    End a display-writing routine, overwrite in subclasses if
@@ -264,6 +335,10 @@ void Adafruit_GFX::endWrite() {}
 /**************************************************************************/
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
                                  uint16_t color) {
+  GFX_PROBE(VLINE);
+  int16_t w = 1;
+  if (!clipRect(x, y, w, h))
+    return;
   startWrite();
   writeLine(x, y, x, y + h - 1, color);
   endWrite();
@@ -281,11 +356,30 @@ void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
 /**************************************************************************/
 void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
                                  uint16_t color) {
+  GFX_PROBE(HLINE);
   startWrite();
-  writeLine(x, y, x + w - 1, y, color);
+  writeSpan(x, y, w, color);
   endWrite();
 }
 
+/**************************************************************************/
+/*!
+   @brief    Write one clipped row of pixels as full masks of up to 32 pixels,
+   see writeSpanMask()
+    @param    x   Left-most x coordinate
+    @param    y   Row y coordinate
+    @param    w   Width in pixels
+   @param    color 16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeSpan(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  int16_t h = 1;
+  if (!clipRect(x, y, w, h))
+    return;
+  for (; w > 0; x += 32, w -= 32)
+    writeSpanMask(x, y, (w < 32) ? w : 32, 0xFFFFFFFFUL, color);
+}
+
 /**************************************************************************/
 /*!
    @brief    Fill a rectangle completely with one color. Update in subclasses if
@@ -299,9 +393,12 @@ void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
 /**************************************************************************/
 void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
                             uint16_t color) {
+  GFX_PROBE(FILL_RECT);
+  if ((w <= 0) || !clipRect(x, y, w, h))
+    return;
   startWrite();
-  for (int16_t i = x; i < x + w; i++) {
-    writeFastVLine(i, y, h, color);
+  for (int16_t j = y; j < y + h; j++) {
+    writeFastHLine(x, j, w, color);
   }
   endWrite();
 }
@@ -314,6 +411,7 @@ void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 */
 /**************************************************************************/
 void Adafruit_GFX::fillScreen(uint16_t color) {
+  GFX_PROBE(FILL_SCREEN);
   fillRect(0, 0, _width, _height, color);
 }
 
@@ -329,6 +427,10 @@ void Adafruit_GFX::fillScreen(uint16_t color) {
 /**************************************************************************/
 void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                             uint16_t color) {
+  GFX_PROBE(LINE);
+  if (clipRejects(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1,
+                  abs(y1 - y0) + 1))
+    return;
   // Update in subclasses if desired!
   if (x0 == x1) {
     if (y0 > y1)
@@ -356,6 +458,9 @@ void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 /**************************************************************************/
 void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
                               uint16_t color) {
+  GFX_PROBE(CIRCLE);
+  if ((r >= 0) && clipRejects(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1))
+    return;
 #if defined(ESP8266)
   yield();
 #endif
@@ -406,6 +511,9 @@ void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                     uint8_t cornername, uint16_t color) {
+  GFX_PROBE(CIRCLE_HELPER);
+  if ((r >= 0) && clipRejects(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1))
+    return;
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
@@ -451,6 +559,9 @@ void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
                               uint16_t color) {
+  GFX_PROBE(FILL_CIRCLE);
+  if ((r >= 0) && clipRejects(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1))
+    return;
   startWrite();
   writeFastVLine(x0, y0 - r, 2 * r + 1, color);
   fillCircleHelper(x0, y0, r, 3, 0, color);
@@ -471,6 +582,10 @@ void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
 void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                     uint8_t corners, int16_t delta,
                                     uint16_t color) {
+  GFX_PROBE(FILL_CIRCLE_HELPER);
+  if ((r >= 0) && (delta >= 0) &&
+      clipRejects(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1 + delta))
+    return;
 
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
@@ -482,6 +597,16 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 
   delta++; // Avoid some +1's in the loop
 
+  // The quarter circles are symmetric about their diagonals, so the row t
+  // above y0 reaches as far out as the column t to the side of x0 reaches up,
+  // and each column of the midpoint loop can go out as two rows instead. The
+  // delta rows of the middle then span all r columns. Rows are spans for
+  // writeSpanMask(), but in rotations 1 and 3 the columns are the raw rows of
+  // a framebuffer, so they stay columns there.
+  bool rows = !(rotation & 1);
+  for (int16_t j = 0; rows && (j < delta); j++)
+    writeCircleRow(x0, y0 + j, r, corners, color);
+
   while (x < y) {
     if (f >= 0) {
       y--;
@@ -493,23 +618,66 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     f += ddF_x;
     // These checks avoid double-drawing certain lines, important
     // for the SSD1306 library which has an INVERT drawing mode.
-    if (x < (y + 1)) {
-      if (corners & 1)
-        writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
-      if (corners & 2)
-        writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
-    }
+    if (x < (y + 1))
+      writeCircleLines(x0, y0, x, y, corners, delta, rows, color);
     if (y != py) {
-      if (corners & 1)
-        writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
-      if (corners & 2)
-        writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      writeCircleLines(x0, y0, py, px, corners, delta, rows, color);
       py = y;
     }
     px = x;
   }
 }
 
+/**************************************************************************/
+/*!
+    @brief  The column t of fillCircleHelper() on either side of x0, which
+   reaches h pixels above y0 and h + delta - 1 below, or the two rows that
+   stand for it
+    @param  x0       Center-point x coordinate
+    @param  y0       Center-point y coordinate
+    @param  t        Distance of the column from x0
+    @param  h        Height of the column above y0
+    @param  corners  Mask bits indicating which quarters we're doing
+    @param  delta    Offset from center-point plus one
+    @param  rows     Write rows t above and below instead
+    @param  color    16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeCircleLines(int16_t x0, int16_t y0, int16_t t,
+                                    int16_t h, uint8_t corners, int16_t delta,
+                                    bool rows, uint16_t color) {
+  if (rows) {
+    writeCircleRow(x0, y0 - t, h, corners, color);
+    writeCircleRow(x0, y0 + delta - 1 + t, h, corners, color);
+    return;
+  }
+  if (corners & 1)
+    writeFastVLine(x0 + t, y0 - h, 2 * h + delta, color);
+  if (corners & 2)
+    writeFastVLine(x0 - t, y0 - h, 2 * h + delta, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  One row of fillCircleHelper(), w pixels to the right of x0 for
+   corner 1 and to the left for corner 2
+    @param  x0       Center-point x coordinate
+    @param  y        Row y coordinate
+    @param  w        Pixels on either side, not counting x0
+    @param  corners  Mask bits indicating which quarters we're doing
+    @param  color    16-bit 5-6-5 Color to fill with
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeCircleRow(int16_t x0, int16_t y, int16_t w,
+                                  uint8_t corners, uint16_t color) {
+  if (w <= 0)
+    return;
+  if (corners & 1)
+    writeSpan(x0 + 1, y, w, color);
+  if (corners & 2)
+    writeSpan(x0 - w, y, w, color);
+}
+
 /**************************************************************************/
 /*!
    @brief   Draw a rectangle with no fill color
@@ -522,6 +690,7 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 /**************************************************************************/
 void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
                             uint16_t color) {
+  GFX_PROBE(RECT);
   startWrite();
   writeFastHLine(x, y, w, color);
   writeFastHLine(x, y + h - 1, w, color);
@@ -543,6 +712,10 @@ void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
 /**************************************************************************/
 void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
                                  int16_t r, uint16_t color) {
+  GFX_PROBE(ROUND_RECT);
+  // Only sane shapes stay inside their rect
+  if ((w > 0) && (h > 0) && (r >= 0) && clipRejects(x, y, w, h))
+    return;
   int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
   if (r > max_radius)
     r = max_radius;
@@ -573,6 +746,10 @@ void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
 /**************************************************************************/
 void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
                                  int16_t r, uint16_t color) {
+  GFX_PROBE(FILL_ROUND_RECT);
+  // Only sane shapes stay inside their rect
+  if ((w > 0) && (h > 0) && (r >= 0) && clipRejects(x, y, w, h))
+    return;
   int16_t max_radius = ((w < h) ? w : h) / 2; // 1/2 minor axis
   if (r > max_radius)
     r = max_radius;
@@ -599,6 +776,7 @@ void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
 /**************************************************************************/
 void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                                 int16_t x2, int16_t y2, uint16_t color) {
+  GFX_PROBE(TRIANGLE);
   drawLine(x0, y0, x1, y1, color);
   drawLine(x1, y1, x2, y2, color);
   drawLine(x2, y2, x0, y0, color);
@@ -618,6 +796,7 @@ void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 /**************************************************************************/
 void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                                 int16_t x2, int16_t y2, uint16_t color) {
+  GFX_PROBE(FILL_TRIANGLE);
 
   int16_t a, b, y, last;
 
@@ -635,6 +814,11 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     _swap_int16_t(x0, x1);
   }
 
+  // Rows outside the clip are skipped whole, the spans of the others are
+  // trimmed to it by the line code
+  if ((y2 < clipY0) || (y0 >= clipY1))
+    return;
+
   startWrite();
   if (y0 == y2) { // Handle awkward all-on-same-line case as its own thing
     a = b = x0;
@@ -716,22 +900,11 @@ void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                               int16_t w, int16_t h, uint16_t color) {
+  GFX_PROBE(BITMAP);
+  if (clipRejects(x, y, w, h))
+    return;
 
-  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-  uint8_t byte = 0;
-
-  startWrite();
-  for (int16_t j = 0; j < h; j++, y++) {
-    for (int16_t i = 0; i < w; i++) {
-      if (i & 7)
-        byte <<= 1;
-      else
-        byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
-      if (byte & 0x80)
-        writePixel(x + i, y, color);
-    }
-  }
-  endWrite();
+  writeBitmapSpans(x, y, bitmap, w, h, color, color, false, true);
 }
 
 /**************************************************************************/
@@ -751,21 +924,11 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                               int16_t w, int16_t h, uint16_t color,
                               uint16_t bg) {
+  GFX_PROBE(BITMAP);
+  if (clipRejects(x, y, w, h))
+    return;
 
-  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-  uint8_t byte = 0;
-
-  startWrite();
-  for (int16_t j = 0; j < h; j++, y++) {
-    for (int16_t i = 0; i < w; i++) {
-      if (i & 7)
-        byte <<= 1;
-      else
-        byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
-      writePixel(x + i, y, (byte & 0x80) ? color : bg);
-    }
-  }
-  endWrite();
+  writeBitmapSpans(x, y, bitmap, w, h, color, bg, true, true);
 }
 
 /**************************************************************************/
@@ -782,22 +945,11 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
                               int16_t h, uint16_t color) {
+  GFX_PROBE(BITMAP);
+  if (clipRejects(x, y, w, h))
+    return;
 
-  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-  uint8_t byte = 0;
-
-  startWrite();
-  for (int16_t j = 0; j < h; j++, y++) {
-    for (int16_t i = 0; i < w; i++) {
-      if (i & 7)
-        byte <<= 1;
-      else
-        byte = bitmap[j * byteWidth + i / 8];
-      if (byte & 0x80)
-        writePixel(x + i, y, color);
-    }
-  }
-  endWrite();
+  writeBitmapSpans(x, y, bitmap, w, h, color, color, false, false);
 }
 
 /**************************************************************************/
@@ -816,18 +968,49 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
 /**************************************************************************/
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
                               int16_t h, uint16_t color, uint16_t bg) {
+  GFX_PROBE(BITMAP);
+  if (clipRejects(x, y, w, h))
+    return;
+
+  writeBitmapSpans(x, y, bitmap, w, h, color, bg, true, false);
+}
 
+/**************************************************************************/
+/*!
+   @brief      Write a 1-bit image as row masks of up to 32 pixels, see
+   writeSpanMask(). With opaque, the clear bits go out as a second mask in bg.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color 16-bit 5-6-5 Color to draw set bits with
+    @param    bg 16-bit 5-6-5 Color to draw clear bits with
+    @param    opaque  If false, clear bits are transparent and bg is ignored
+    @param    progmem  True if bitmap is PROGMEM-resident
+*/
+/**************************************************************************/
+void Adafruit_GFX::writeBitmapSpans(int16_t x, int16_t y,
+                                    const uint8_t *bitmap, int16_t w,
+                                    int16_t h, uint16_t color, uint16_t bg,
+                                    bool opaque, bool progmem) {
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-  uint8_t byte = 0;
 
   startWrite();
   for (int16_t j = 0; j < h; j++, y++) {
-    for (int16_t i = 0; i < w; i++) {
-      if (i & 7)
-        byte <<= 1;
-      else
-        byte = bitmap[j * byteWidth + i / 8];
-      writePixel(x + i, y, (byte & 0x80) ? color : bg);
+    const uint8_t *row = &bitmap[j * byteWidth];
+    for (int16_t i = 0; i < w; i += 32) {
+      int16_t n = (w - i < 32) ? w - i : 32;
+      uint32_t mask = 0;
+      for (int16_t k = 0; k < (n + 7) / 8; k++) {
+        const uint8_t *src = &row[i / 8 + k];
+        uint8_t byte = progmem ? pgm_read_byte(src) : *src;
+        mask |= (uint32_t)byte << (24 - 8 * k);
+      }
+      uint32_t used = (n < 32) ? ~(0xFFFFFFFFUL >> n) : 0xFFFFFFFFUL;
+      writeSpanMask(x + i, y, n, mask & used, color);
+      if (opaque)
+        writeSpanMask(x + i, y, n, ~mask & used, bg);
     }
   }
   endWrite();
@@ -850,6 +1033,9 @@ void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
 /**************************************************************************/
 void Adafruit_GFX::drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
                                int16_t w, int16_t h, uint16_t color) {
+  GFX_PROBE(BITMAP);
+  if (clipRejects(x, y, w, h))
+    return;
 
   int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
   uint8_t byte = 0;
@@ -1134,13 +1320,11 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
                             uint16_t color, uint16_t bg, uint8_t size_x,
                             uint8_t size_y) {
+  GFX_PROBE(CHAR);
 
   if (!gfxFont) { // 'Classic' built-in font
 
-    if ((x >= _width) ||              // Clip right
-        (y >= _height) ||             // Clip bottom
-        ((x + 6 * size_x - 1) < 0) || // Clip left
-        ((y + 8 * size_y - 1) < 0))   // Clip top
+    if (clipRejects(x, y, 6 * size_x, 8 * size_y))
       return;
 
     if (!_cp437 && (c >= 176))
@@ -1186,15 +1370,12 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
     int8_t xo = pgm_read_byte(&glyph->xOffset),
            yo = pgm_read_byte(&glyph->yOffset);
-    uint8_t xx, yy, bits = 0, bit = 0;
-    int16_t xo16 = 0, yo16 = 0;
-
-    if (size_x > 1 || size_y > 1) {
-      xo16 = xo;
-      yo16 = yo;
-    }
+    uint8_t yy, bits = 0, bit = 0;
 
-    // Todo: Add character clipping here
+    // Glyphs entirely outside the clip are skipped, the spans of the others
+    // are trimmed to it where they are drawn
+    if (clipRejects(x + xo * size_x, y + yo * size_y, w * size_x, h * size_y))
+      return;
 
     // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
     // THIS IS ON PURPOSE AND BY DESIGN.  The background color feature
@@ -1212,25 +1393,152 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
 
+    // Glyphs may be stored pre-rotated (see gfxfont.h), a quarter turn swaps
+    // the stored width and height
+    uint8_t format = pgm_read_byte(&gfxFont->format);
+    uint8_t r = rotation, fr = GFXFONT_ROTATION(format);
+    bool rotated = GFXFONT_IS_ROTATED(format);
+    uint8_t sw = (rotated && (fr & 1)) ? h : w;
+    uint8_t sh = (rotated && (fr & 1)) ? w : h;
+
+    // Top left of the glyph box and the size of one stored pixel where the
+    // spans go. For a font rotated to match the display, that is the glyph
+    // box in panel coordinates, drawn at rotation 0.
+    int16_t gx = x + xo * size_x, gy = y + yo * size_y;
+    int16_t ox = gx, oy = gy;
+    uint8_t px = size_x, py = size_y;
+    bool native = rotated && (fr == r);
+    if (native) {
+      int16_t bw = w * size_x, bh = h * size_y;
+      switch (r) {
+      case 1:
+        ox = WIDTH - gy - bh;
+        oy = gx;
+        break;
+      case 2:
+        ox = WIDTH - gx - bw;
+        oy = HEIGHT - gy - bh;
+        break;
+      case 3:
+        ox = gy;
+        oy = HEIGHT - gx - bw;
+        break;
+      }
+      if (r & 1) {
+        px = size_y;
+        py = size_x;
+      }
+      setRotation(0);
+    }
+
+    // Unscaled rows are gathered into masks of 32 pixels and go out through
+    // writeSpanMask() once the row is complete. Scaled, every run of set bits
+    // is one rectangle.
+    bool masks = (px == 1) && (py == 1) && !(rotated && !native);
+    uint32_t row[8] = {0}; // Up to 256 pixels, more than a glyph row holds
+    auto flush = [&]() {
+      for (int16_t k = 0; k * 32 < sw; k++) {
+        if (row[k]) {
+          int16_t n = (sw - k * 32 < 32) ? sw - k * 32 : 32;
+          writeSpanMask(ox + k * 32, oy + yy, n, row[k], color);
+          row[k] = 0;
+        }
+      }
+    };
+    auto span = [&](int16_t xx, int16_t n) {
+      if (rotated && !native) {
+        // Stored for another rotation, turn every pixel back upright
+        for (; n > 0; n--, xx++) {
+          int16_t i = xx, j = yy;
+          switch (fr) {
+          case 1:
+            i = yy;
+            j = h - 1 - xx;
+            break;
+          case 2:
+            i = w - 1 - xx;
+            j = h - 1 - yy;
+            break;
+          case 3:
+            i = w - 1 - yy;
+            j = xx;
+            break;
+          }
+          writeFillRect(gx + i * size_x, gy + j * size_y, size_x, size_y,
+                        color);
+        }
+      } else if (masks) {
+        while (n > 0) {
+          int16_t s = xx & 31, m = (n < 32 - s) ? n : 32 - s;
+          uint32_t bits = 0xFFFFFFFFUL >> s;
+          if (s + m < 32)
+            bits &= ~(0xFFFFFFFFUL >> (s + m));
+          row[xx >> 5] |= bits;
+          xx += m;
+          n -= m;
+        }
+      } else {
+        writeFillRect(ox + xx * px, oy + yy * py, n * px, py, color);
+      }
+    };
+
     startWrite();
-    for (yy = 0; yy < h; yy++) {
-      for (xx = 0; xx < w; xx++) {
-        if (!(bit++ & 7)) {
+    if ((format & GFXFONT_ENCODING) == GFXFONT_RLE) {
+      // Runs come straight from the encoding, split where they wrap rows
+      bool on = false;
+      int16_t xx = 0;
+      yy = 0;
+      while (sw && (yy < sh)) {
+        uint16_t len = 0;
+        do {
           bits = pgm_read_byte(&bitmap[bo++]);
+          len += bits;
+        } while (bits == 255);
+        while (len) {
+          int16_t n = min((int16_t)len, (int16_t)(sw - xx));
+          if (on)
+            span(xx, n);
+          len -= n;
+          if ((xx += n) == sw) {
+            if (masks)
+              flush();
+            xx = 0;
+            yy++;
+          }
         }
-        if (bits & 0x80) {
-          if (size_x == 1 && size_y == 1) {
-            writePixel(x + xo + xx, y + yo + yy, color);
-          } else {
-            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
-                          size_x, size_y, color);
+        on = !on;
+      }
+    } else {
+      // Decode each row into runs of set bits. One step past the row end
+      // closes a run that reaches it.
+      for (yy = 0; yy < sh; yy++) {
+        int16_t run = -1; // Start of the current run of set bits, if any
+        for (int16_t xx = 0; xx <= sw; xx++) {
+          bool on = false;
+          if (xx < sw) {
+            if (!(bit++ & 7)) {
+              bits = pgm_read_byte(&bitmap[bo++]);
+            }
+            on = bits & 0x80;
+            bits <<= 1;
+          }
+          if (on) {
+            if (run < 0)
+              run = xx;
+          } else if (run >= 0) {
+            span(run, xx - run);
+            run = -1;
           }
         }
-        bits <<= 1;
+        if (masks)
+          flush();
       }
     }
     endWrite();
 
+    if (native)
+      setRotation(r);
+
   } // End classic vs custom font
 }
 /**************************************************************************/
@@ -1327,6 +1635,155 @@ void Adafruit_GFX::setRotation(uint8_t x) {
     _height = WIDTH;
     break;
   }
+  updateClip();
+}
+
+/**************************************************************************/
+/*!
+    @brief      Limit drawing to a rect, on top of the clip already set. Each
+   push has to be matched by a popClipRect().
+    @param  x   Left edge, accounting for current rotation
+    @param  y   Top edge, accounting for current rotation
+    @param  w   Width in pixels
+    @param  h   Height in pixels
+    @returns    False if GFX_CLIP_DEPTH clips are already pushed, nothing was
+   pushed then
+*/
+/**************************************************************************/
+bool Adafruit_GFX::pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (clipDepth >= GFX_CLIP_DEPTH)
+    return false;
+
+  // Kept in raw coordinates, so that the clip stays put across rotations
+  int16_t rx = x, ry = y, rw = w, rh = h;
+  switch (rotation) {
+  case 1:
+    rx = WIDTH - y - h;
+    ry = x;
+    rw = h;
+    rh = w;
+    break;
+  case 2:
+    rx = WIDTH - x - w;
+    ry = HEIGHT - y - h;
+    break;
+  case 3:
+    rx = y;
+    ry = HEIGHT - x - w;
+    rw = h;
+    rh = w;
+    break;
+  }
+
+  int16_t x0 = 0, y0 = 0, x1 = WIDTH, y1 = HEIGHT;
+  if (clipDepth) {
+    const int16_t *below = clipStack[clipDepth - 1];
+    x0 = below[0];
+    y0 = below[1];
+    x1 = below[0] + below[2];
+    y1 = below[1] + below[3];
+  }
+  if (rx > x0)
+    x0 = rx;
+  if (ry > y0)
+    y0 = ry;
+  if (rx + rw < x1)
+    x1 = rx + rw;
+  if (ry + rh < y1)
+    y1 = ry + rh;
+
+  int16_t *clip = clipStack[clipDepth++];
+  clip[0] = x0;
+  clip[1] = y0;
+  clip[2] = (x1 > x0) ? x1 - x0 : 0;
+  clip[3] = (y1 > y0) ? y1 - y0 : 0;
+  updateClip();
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Restore the clip from before the last pushClipRect()
+*/
+/**************************************************************************/
+void Adafruit_GFX::popClipRect(void) {
+  if (clipDepth)
+    clipDepth--;
+  updateClip();
+}
+
+/**************************************************************************/
+/*!
+    @brief      Trim a rect to the clip. Negative sizes are turned around the
+   first row or column first, as the line functions take them.
+    @param  x   Left edge, accounting for current rotation
+    @param  y   Top edge, accounting for current rotation
+    @param  w   Width in pixels
+    @param  h   Height in pixels
+    @returns    False if nothing of the rect is left to draw
+*/
+/**************************************************************************/
+bool Adafruit_GFX::clipRect(int16_t &x, int16_t &y, int16_t &w,
+                            int16_t &h) const {
+  if (w < 0) {
+    w = -w;
+    x -= w - 1;
+  }
+  if (h < 0) {
+    h = -h;
+    y -= h - 1;
+  }
+  if (x < clipX0) {
+    w -= clipX0 - x;
+    x = clipX0;
+  }
+  if (y < clipY0) {
+    h -= clipY0 - y;
+    y = clipY0;
+  }
+  if (x + w > clipX1)
+    w = clipX1 - x;
+  if (y + h > clipY1)
+    h = clipY1 - y;
+  return (w > 0) && (h > 0);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Bring the clip bounds in rotated coordinates up to date with
+   the clip stack and rotation
+*/
+/**************************************************************************/
+void Adafruit_GFX::updateClip(void) {
+  if (!clipDepth) {
+    clipX0 = clipY0 = 0;
+    clipX1 = _width;
+    clipY1 = _height;
+    return;
+  }
+
+  const int16_t *clip = clipStack[clipDepth - 1];
+  int16_t x = clip[0], y = clip[1], w = clip[2], h = clip[3];
+  switch (rotation) {
+  case 0:
+    clipX0 = x;
+    clipY0 = y;
+    break;
+  case 1:
+    clipX0 = y;
+    clipY0 = WIDTH - x - w;
+    break;
+  case 2:
+    clipX0 = WIDTH - x - w;
+    clipY0 = HEIGHT - y - h;
+    break;
+  case 3:
+    clipX0 = HEIGHT - y - h;
+    clipY0 = x;
+    break;
+  }
+  clipX1 = clipX0 + ((rotation & 1) ? h : w);
+  clipY1 = clipY0 + ((rotation & 1) ? w : h);
 }
 
 /**************************************************************************/
@@ -1448,6 +1905,7 @@ void Adafruit_GFX::charBounds(unsigned char c, int16_t *x, int16_t *y,
 void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y,
                                  int16_t *x1, int16_t *y1, uint16_t *w,
                                  uint16_t *h) {
+  GFX_PROBE(TEXT_BOUNDS);
 
   uint8_t c; // Current character
   int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1; // Bound rect
@@ -1542,6 +2000,17 @@ void Adafruit_GFX::invertDisplay(bool i) {
   (void)i; // disable -Wunused-parameter warning
 }
 
+#ifdef GFX_PROFILE
+/**************************************************************************/
+/*!
+    @brief      Report draw calls and pixel writes to a profiler. Displays
+   that draw into another GFX object should pass it on.
+    @param   p  The profiler, or NULL to stop profiling
+*/
+/**************************************************************************/
+void Adafruit_GFX::setProfiler(GFXprofiler *p) { profiler = p; }
+#endif
+
 /***************************************************************************/
 
 /**************************************************************************/
@@ -1784,8 +2253,9 @@ GFXcanvas1::~GFXcanvas1(void) {
 */
 /**************************************************************************/
 void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  GFX_PROBE(PIXEL);
   if (buffer) {
-    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    if (!clipContains(x, y))
       return;
 
     int16_t t;
@@ -1806,6 +2276,10 @@ void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
       break;
     }
 
+#ifdef GFX_PROFILE
+    if (profiler)
+      profiler->pixel(x, y);
+#endif
     uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
 #ifdef __AVR__
     if (color)
@@ -1885,7 +2359,16 @@ bool GFXcanvas1::getRawPixel(int16_t x, int16_t y) const {
 */
 /**************************************************************************/
 void GFXcanvas1::fillScreen(uint16_t color) {
+  GFX_PROBE(FILL_SCREEN);
+  if (clipDepth) { // Only the clip is filled, through the clipped lines
+    Adafruit_GFX::fillScreen(color);
+    return;
+  }
   if (buffer) {
+#ifdef GFX_PROFILE
+    if (profiler)
+      profiler->rect(0, 0, WIDTH, HEIGHT);
+#endif
     uint16_t bytes = ((WIDTH + 7) / 8) * HEIGHT;
     memset(buffer, color ? 0xFF : 0x00, bytes);
   }
@@ -1902,28 +2385,10 @@ void GFXcanvas1::fillScreen(uint16_t color) {
 /**************************************************************************/
 void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
                                uint16_t color) {
-
-  if (h < 0) { // Convert negative heights to positive equivalent
-    h *= -1;
-    y -= h - 1;
-    if (y < 0) {
-      h += y;
-      y = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+  GFX_PROBE(VLINE);
+  int16_t w = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (y < 0) { // Clip top
-    h += y;
-    y = 0;
-  }
-  if (y + h > height()) { // Clip bottom
-    h = height() - y;
-  }
 
   if (getRotation() == 0) {
     drawFastRawVLine(x, y, h, color);
@@ -1958,27 +2423,10 @@ void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h,
 /**************************************************************************/
 void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
                                uint16_t color) {
-  if (w < 0) { // Convert negative widths to positive equivalent
-    w *= -1;
-    x -= w - 1;
-    if (x < 0) {
-      w += x;
-      x = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+  GFX_PROBE(HLINE);
+  int16_t h = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (x < 0) { // Clip left
-    w += x;
-    x = 0;
-  }
-  if (x + w >= width()) { // Clip right
-    w = width() - x;
-  }
 
   if (getRotation() == 0) {
     drawFastRawHLine(x, y, w, color);
@@ -2002,6 +2450,130 @@ void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
   }
 }
 
+/**************************************************************************/
+/*!
+   @brief  Speed optimized rectangle fill, one raw horizontal line per raw row
+   whatever the rotation
+   @param  x      Top left corner x coordinate
+   @param  y      Top left corner y coordinate
+   @param  w      Width in pixels
+   @param  h      Height in pixels
+   @param  color  Color to fill with
+*/
+/**************************************************************************/
+void GFXcanvas1::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                          uint16_t color) {
+  GFX_PROBE(FILL_RECT);
+  if (!buffer || (w <= 0) || !clipRect(x, y, w, h))
+    return;
+
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - y - h;
+    y = t;
+    _swap_int16_t(w, h);
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = HEIGHT - t - w;
+    _swap_int16_t(w, h);
+    break;
+  }
+  for (int16_t j = y; j < y + h; j++)
+    drawFastRawHLine(x, j, w, color);
+}
+
+/**************************************************************************/
+/*!
+   @brief  Write up to 32 pixels of one row from a packed mask straight into
+   the canvas buffer. The mask is trimmed to the clip once. Where the row
+   runs along a raw row (rotations 0 and 2, reversed for 2) it is shifted into
+   place and combined a byte at a time, otherwise it walks down or up a raw
+   column.
+   @param  x      Left-most x coordinate
+   @param  y      Row y coordinate
+   @param  w      Width in pixels, 1 to 32
+   @param  mask   Pixel x in bit 31, x + 1 in bit 30 and so on
+   @param  color  Binary (on or off) color to draw set bits with
+*/
+/**************************************************************************/
+void GFXcanvas1::writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask,
+                               uint16_t color) {
+  if (!buffer || (y < clipY0) || (y >= clipY1) || (w <= 0))
+    return;
+  if (x < clipX0) {
+    if (clipX0 - x >= w)
+      return;
+    mask <<= clipX0 - x;
+    w -= clipX0 - x;
+    x = clipX0;
+  }
+  if (x + w > clipX1)
+    w = clipX1 - x;
+  if (w <= 0)
+    return;
+  if (w < 32)
+    mask &= ~(0xFFFFFFFFUL >> w);
+  if (!mask)
+    return;
+
+  int16_t rowBytes = (WIDTH + 7) / 8;
+  if (!(rotation & 1)) {
+    // Along a raw row, mirrored in rotation 2 so that the last pixel of the
+    // span comes first
+    int16_t rx = x, ry = y;
+    if (rotation == 2) {
+      rx = WIDTH - x - w;
+      ry = HEIGHT - 1 - y;
+      mask = reverse32(mask) << (32 - w);
+    }
+#ifdef GFX_PROFILE
+    if (profiler) {
+      for (int16_t i = 0; i < w; i++)
+        if (mask & (0x80000000UL >> i))
+          profiler->pixel(rx + i, ry);
+    }
+#endif
+    // Bit 63 is the MSB of the first raw byte
+    uint64_t bits = (uint64_t)mask << (32 - (rx & 7));
+    uint8_t *ptr = &buffer[(rx / 8) + ry * rowBytes];
+    for (int16_t k = 0; k < ((rx & 7) + w + 7) / 8; k++, bits <<= 8) {
+      uint8_t byte = bits >> 56;
+      if (color)
+        ptr[k] |= byte;
+      else
+        ptr[k] &= ~byte;
+    }
+    return;
+  }
+
+  // Rotation 1 runs down raw column WIDTH - 1 - y, rotation 3 up column y
+  int16_t rx = (rotation == 1) ? WIDTH - 1 - y : y;
+  int16_t ry = (rotation == 1) ? x : HEIGHT - 1 - x;
+  int16_t dy = (rotation == 1) ? 1 : -1;
+  uint8_t *ptr = &buffer[(rx / 8) + ry * rowBytes];
+  uint8_t bit = 0x80 >> (rx & 7);
+  for (; mask; mask <<= 1, ptr += dy * rowBytes, ry += dy) {
+    if (!(mask & 0x80000000UL))
+      continue;
+#ifdef GFX_PROFILE
+    if (profiler)
+      profiler->pixel(rx, ry);
+#endif
+    if (color)
+      *ptr |= bit;
+    else
+      *ptr &= ~bit;
+  }
+}
+
 /**************************************************************************/
 /*!
    @brief    Speed optimized vertical line drawing into the raw canvas buffer
@@ -2014,6 +2586,10 @@ void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w,
 void GFXcanvas1::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+#ifdef GFX_PROFILE
+  if (profiler)
+    profiler->rect(x, y, 1, h);
+#endif
   int16_t row_bytes = ((WIDTH + 7) / 8);
   uint8_t *buffer = this->getBuffer();
   uint8_t *ptr = &buffer[(x / 8) + y * row_bytes];
@@ -2053,6 +2629,10 @@ void GFXcanvas1::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
 void GFXcanvas1::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                   uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
+#ifdef GFX_PROFILE
+  if (profiler)
+    profiler->rect(x, y, w, 1);
+#endif
   int16_t rowBytes = ((WIDTH + 7) / 8);
   uint8_t *buffer = this->getBuffer();
   uint8_t *ptr = &buffer[(x / 8) + y * rowBytes];
@@ -2107,6 +2687,323 @@ void GFXcanvas1::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
   }
 }
 
+/**************************************************************************/
+/*!
+   @brief      Draw a PROGMEM-resident 1-bit image straight into the canvas
+   buffer, see blitBitmap()
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color Binary (on or off) color to draw set bits with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                            int16_t w, int16_t h, uint16_t color) {
+  GFX_PROBE(BITMAP);
+#ifdef __AVR__
+  Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+#else
+  blitBitmap(x, y, bitmap, w, h, color, color, false);
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief      Draw a PROGMEM-resident 1-bit image straight into the canvas
+   buffer with an opaque background, see blitBitmap()
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color Binary (on or off) color to draw set bits with
+    @param    bg Binary (on or off) color to draw unset bits with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                            int16_t w, int16_t h, uint16_t color,
+                            uint16_t bg) {
+  GFX_PROBE(BITMAP);
+#ifdef __AVR__
+  Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+#else
+  blitBitmap(x, y, bitmap, w, h, color, bg, true);
+#endif
+}
+
+/**************************************************************************/
+/*!
+   @brief      Draw a RAM-resident 1-bit image straight into the canvas
+   buffer, see blitBitmap()
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color Binary (on or off) color to draw set bits with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                            int16_t h, uint16_t color) {
+  GFX_PROBE(BITMAP);
+  blitBitmap(x, y, bitmap, w, h, color, color, false);
+}
+
+/**************************************************************************/
+/*!
+   @brief      Draw a RAM-resident 1-bit image straight into the canvas
+   buffer with an opaque background, see blitBitmap()
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color Binary (on or off) color to draw set bits with
+    @param    bg Binary (on or off) color to draw unset bits with
+*/
+/**************************************************************************/
+void GFXcanvas1::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                            int16_t h, uint16_t color, uint16_t bg) {
+  GFX_PROBE(BITMAP);
+  blitBitmap(x, y, bitmap, w, h, color, bg, true);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Bulk 1-bit blit into the raw canvas buffer. The bitmap is clipped
+   once up front instead of per pixel. In rotation 0 each scanline is combined
+   a byte at a time (shifted when x is not on a byte boundary, 32 bits at a
+   time when it is). In rotation 1 bitmap rows become raw columns, so blocks
+   of 8x8 pixels are transposed and written a raw byte at a time. Rotations 2
+   and 3 walk each bitmap row along the raw buffer with a precomputed bit mask
+   and stride. None of them do a per-pixel coordinate transform or virtual
+   call.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap, directly addressable
+    @param    w   Width of bitmap in pixels
+    @param    h   Height of bitmap in pixels
+    @param    color Binary (on or off) color to draw set bits with
+    @param    bg Binary (on or off) color to draw unset bits with
+    @param    opaque  If false, unset bits are transparent and bg is ignored
+*/
+/**************************************************************************/
+void GFXcanvas1::blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                            int16_t w, int16_t h, uint16_t color, uint16_t bg,
+                            bool opaque) {
+  if (!buffer)
+    return;
+
+  // Clip to the clip rect once, i0/j0 are the first visible bitmap column
+  // and row, i1/j1 one past the last
+  int16_t i0 = (x < clipX0) ? clipX0 - x : 0;
+  int16_t j0 = (y < clipY0) ? clipY0 - y : 0;
+  int16_t i1 = (x + w > clipX1) ? clipX1 - x : w;
+  int16_t j1 = (y + h > clipY1) ? clipY1 - y : h;
+  if ((i0 >= i1) || (j0 >= j1))
+    return;
+#ifdef GFX_PROFILE
+  if (profiler)
+    profileBitmap(x, y, bitmap, w, i0, j0, i1, j1, opaque);
+#endif
+
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  int16_t rowBytes = (WIDTH + 7) / 8;
+  uint8_t fg = color ? 0xFF : 0x00, bk = bg ? 0xFF : 0x00;
+
+  if (rotation == 0) {
+    int16_t first = x + i0, last = x + i1 - 1; // Raw x range covered
+    uint8_t firstMask = 0xFF >> (first & 7);
+    uint8_t lastMask = 0xFF << (7 - (last & 7));
+
+    for (int16_t j = j0; j < j1; j++) {
+      const uint8_t *src = &bitmap[j * byteWidth];
+      uint8_t *dst = &buffer[(y + j) * rowBytes];
+      int16_t db = first / 8, lastByte = last / 8;
+
+      while (db <= lastByte) {
+        // Source bit under the MSB of this destination byte, negative only
+        // for the first byte when x is not byte aligned
+        int16_t p = db * 8 - x;
+        uint8_t mask = 0xFF;
+        if (db == first / 8)
+          mask &= firstMask;
+        if (db == lastByte)
+          mask &= lastMask;
+
+        // Aligned run of whole bytes, combine 32 bits at a time
+        if (!(p & 7) && (mask == 0xFF) && (db + 4 <= lastByte)) {
+          uint32_t s, d;
+          memcpy(&s, &src[p / 8], 4);
+          memcpy(&d, &dst[db], 4);
+          if (opaque)
+            d = (s & (fg * 0x01010101UL)) | (~s & (bk * 0x01010101UL));
+          else
+            d = color ? (d | s) : (d & ~s);
+          memcpy(&dst[db], &d, 4);
+          db += 4;
+          continue;
+        }
+
+        uint8_t bits;
+        if (p < 0) {
+          bits = src[0] >> -p;
+        } else {
+          int16_t k = p / 8, s = p & 7;
+          bits = src[k] << s;
+          if (s && (k + 1 < byteWidth))
+            bits |= src[k + 1] >> (8 - s);
+        }
+
+        if (opaque)
+          dst[db] = (dst[db] & ~mask) | (((bits & fg) | (~bits & bk)) & mask);
+        else if (color)
+          dst[db] |= bits & mask;
+        else
+          dst[db] &= ~(bits & mask);
+        db++;
+      }
+    }
+    return;
+  }
+
+  if (rotation == 1) {
+    // Bitmap rows land in raw columns WIDTH - 1 - y - j, so up to 8 of them
+    // share a raw byte. Gather those rows a source byte at a time, transpose
+    // the 8x8 block and write one raw byte per bitmap column.
+    for (int16_t j = j0; j < j1;) {
+      int16_t rx = WIDTH - 1 - (y + j);
+      int16_t n = (rx & 7) + 1; // Rows left in this raw byte
+      if (n > j1 - j)
+        n = j1 - j;
+
+      uint8_t rowMask = 0;
+      for (int16_t k = 0; k < n; k++)
+        rowMask |= 0x80 >> ((rx - k) & 7);
+
+      for (int16_t b = i0 / 8; b <= (i1 - 1) / 8; b++) {
+        uint8_t block[8] = {0};
+        for (int16_t k = 0; k < n; k++)
+          block[(rx - k) & 7] = bitmap[(j + k) * byteWidth + b];
+        transpose8(block);
+
+        int16_t c0 = (b * 8 < i0) ? i0 - b * 8 : 0;
+        int16_t c1 = (b * 8 + 8 > i1) ? i1 - b * 8 : 8;
+        uint8_t *ptr = &buffer[(rx / 8) + (x + b * 8 + c0) * rowBytes];
+        for (int16_t c = c0; c < c1; c++, ptr += rowBytes) {
+          uint8_t bits = block[c];
+          if (opaque)
+            *ptr = (*ptr & ~rowMask) | (((bits & fg) | (~bits & bk)) & rowMask);
+          else if (color)
+            *ptr |= bits;
+          else
+            *ptr &= ~bits;
+        }
+      }
+      j += n;
+    }
+    return;
+  }
+
+  // Other rotations: locate the raw pixel of bitmap (i0, j) and how a step
+  // along the bitmap row moves through the raw buffer (ptrStep bytes or one
+  // bit)
+  for (int16_t j = j0; j < j1; j++) {
+    int16_t rx, ry, ptrStep = 0, bitStep = 0;
+    if (rotation == 2) {
+      rx = WIDTH - 1 - (x + i0);
+      ry = HEIGHT - 1 - (y + j);
+      bitStep = -1;
+    } else {
+      rx = y + j;
+      ry = HEIGHT - 1 - (x + i0);
+      ptrStep = -rowBytes;
+    }
+
+    uint8_t *ptr = &buffer[(rx / 8) + ry * rowBytes];
+    uint8_t mask = 0x80 >> (rx & 7);
+    const uint8_t *src = &bitmap[j * byteWidth];
+    uint8_t byte = src[i0 / 8] << (i0 & 7);
+
+    for (int16_t i = i0; i < i1; i++) {
+      if (i != i0 && !(i & 7))
+        byte = src[i / 8];
+      if (byte & 0x80) {
+        if (color)
+          *ptr |= mask;
+        else
+          *ptr &= ~mask;
+      } else if (opaque) {
+        if (bg)
+          *ptr |= mask;
+        else
+          *ptr &= ~mask;
+      }
+      byte <<= 1;
+
+      if (bitStep) { // Rotation 2 walks right to left along a raw row
+        mask <<= 1;
+        if (!mask) {
+          mask = 0x01;
+          ptr--;
+        }
+      } else {
+        ptr += ptrStep;
+      }
+    }
+  }
+}
+
+#ifdef GFX_PROFILE
+/**************************************************************************/
+/*!
+   @brief    Report the pixels blitBitmap() writes to the profiler, in raw
+   coordinates. Opaque bitmaps write their whole clipped area, transparent
+   ones only their set bits.
+    @param    x   Top left corner x coordinate
+    @param    y   Top left corner y coordinate
+    @param    bitmap  byte array with monochrome bitmap
+    @param    w   Width of bitmap in pixels
+    @param    i0  First visible bitmap column
+    @param    j0  First visible bitmap row
+    @param    i1  One past the last visible bitmap column
+    @param    j1  One past the last visible bitmap row
+    @param    opaque  If false, unset bits are not written
+*/
+/**************************************************************************/
+void GFXcanvas1::profileBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                               int16_t w, int16_t i0, int16_t j0, int16_t i1,
+                               int16_t j1, bool opaque) {
+  int16_t byteWidth = (w + 7) / 8;
+  for (int16_t j = j0; j < j1; j++) {
+    for (int16_t i = i0; i < i1; i++) {
+      if (!opaque && !(bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7))))
+        continue;
+      int16_t rx = x + i, ry = y + j, t;
+      switch (rotation) {
+      case 1:
+        t = rx;
+        rx = WIDTH - 1 - ry;
+        ry = t;
+        break;
+      case 2:
+        rx = WIDTH - 1 - rx;
+        ry = HEIGHT - 1 - ry;
+        break;
+      case 3:
+        t = rx;
+        rx = ry;
+        ry = HEIGHT - 1 - t;
+        break;
+      }
+      profiler->pixel(rx, ry);
+    }
+  }
+}
+#endif
+
 /**************************************************************************/
 /*!
    @brief    Instatiate a GFX 8-bit canvas context for graphics
@@ -2141,7 +3038,7 @@ GFXcanvas8::~GFXcanvas8(void) {
 /**************************************************************************/
 void GFXcanvas8::drawPixel(int16_t x, int16_t y, uint16_t color) {
   if (buffer) {
-    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    if (!clipContains(x, y))
       return;
 
     int16_t t;
@@ -2221,6 +3118,10 @@ uint8_t GFXcanvas8::getRawPixel(int16_t x, int16_t y) const {
 */
 /**************************************************************************/
 void GFXcanvas8::fillScreen(uint16_t color) {
+  if (clipDepth) { // Only the clip is filled, through the clipped lines
+    Adafruit_GFX::fillScreen(color);
+    return;
+  }
   if (buffer) {
     memset(buffer, color, WIDTH * HEIGHT);
   }
@@ -2238,27 +3139,9 @@ void GFXcanvas8::fillScreen(uint16_t color) {
 /**************************************************************************/
 void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
                                uint16_t color) {
-  if (h < 0) { // Convert negative heights to positive equivalent
-    h *= -1;
-    y -= h - 1;
-    if (y < 0) {
-      h += y;
-      y = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+  int16_t w = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (y < 0) { // Clip top
-    h += y;
-    y = 0;
-  }
-  if (y + h > height()) { // Clip bottom
-    h = height() - y;
-  }
 
   if (getRotation() == 0) {
     drawFastRawVLine(x, y, h, color);
@@ -2294,28 +3177,9 @@ void GFXcanvas8::drawFastVLine(int16_t x, int16_t y, int16_t h,
 /**************************************************************************/
 void GFXcanvas8::drawFastHLine(int16_t x, int16_t y, int16_t w,
                                uint16_t color) {
-
-  if (w < 0) { // Convert negative widths to positive equivalent
-    w *= -1;
-    x -= w - 1;
-    if (x < 0) {
-      w += x;
-      x = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+  int16_t h = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (x < 0) { // Clip left
-    w += x;
-    x = 0;
-  }
-  if (x + w >= width()) { // Clip right
-    w = width() - x;
-  }
 
   if (getRotation() == 0) {
     drawFastRawHLine(x, y, w, color);
@@ -2409,7 +3273,7 @@ GFXcanvas16::~GFXcanvas16(void) {
 /**************************************************************************/
 void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
   if (buffer) {
-    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+    if (!clipContains(x, y))
       return;
 
     int16_t t;
@@ -2489,6 +3353,10 @@ uint16_t GFXcanvas16::getRawPixel(int16_t x, int16_t y) const {
 */
 /**************************************************************************/
 void GFXcanvas16::fillScreen(uint16_t color) {
+  if (clipDepth) { // Only the clip is filled, through the clipped lines
+    Adafruit_GFX::fillScreen(color);
+    return;
+  }
   if (buffer) {
     uint8_t hi = color >> 8, lo = color & 0xFF;
     if (hi == lo) {
@@ -2533,27 +3401,9 @@ void GFXcanvas16::byteSwap(void) {
 /**************************************************************************/
 void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
                                 uint16_t color) {
-  if (h < 0) { // Convert negative heights to positive equivalent
-    h *= -1;
-    y -= h - 1;
-    if (y < 0) {
-      h += y;
-      y = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((x < 0) || (x >= width()) || (y >= height()) || ((y + h - 1) < 0)) {
+  int16_t w = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (y < 0) { // Clip top
-    h += y;
-    y = 0;
-  }
-  if (y + h > height()) { // Clip bottom
-    h = height() - y;
-  }
 
   if (getRotation() == 0) {
     drawFastRawVLine(x, y, h, color);
@@ -2588,27 +3438,9 @@ void GFXcanvas16::drawFastVLine(int16_t x, int16_t y, int16_t h,
 /**************************************************************************/
 void GFXcanvas16::drawFastHLine(int16_t x, int16_t y, int16_t w,
                                 uint16_t color) {
-  if (w < 0) { // Convert negative widths to positive equivalent
-    w *= -1;
-    x -= w - 1;
-    if (x < 0) {
-      w += x;
-      x = 0;
-    }
-  }
-
-  // Edge rejection (no-draw if totally off canvas)
-  if ((y < 0) || (y >= height()) || (x >= width()) || ((x + w - 1) < 0)) {
+  int16_t h = 1;
+  if (!clipRect(x, y, w, h)) // Trim to the clip, or nothing to draw
     return;
-  }
-
-  if (x < 0) { // Clip left
-    w += x;
-    x = 0;
-  }
-  if (x + w >= width()) { // Clip right
-    w = width() - x;
-  }
 
   if (getRotation() == 0) {
     drawFastRawHLine(x, y, w, color);
@@ -2668,3 +3500,247 @@ void GFXcanvas16::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
     buffer[i] = color;
   }
 }
+
+#ifdef GFX_PROFILE
+/**************************************************************************/
+/*!
+   @brief    Create a profiler for a display of the given raw size
+   @param    w   Display width, in pixels, before rotation
+   @param    h   Display height, in pixels, before rotation
+*/
+/**************************************************************************/
+GFXprofiler::GFXprofiler(uint16_t w, uint16_t h) : WIDTH(w), HEIGHT(h) {
+  heatmap = (uint8_t *)malloc((uint32_t)w * h);
+  beginFrame();
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the profiler, free memory
+*/
+/**************************************************************************/
+GFXprofiler::~GFXprofiler(void) {
+  if (heatmap)
+    free(heatmap);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Forget the counts of the previous frame
+*/
+/**************************************************************************/
+void GFXprofiler::beginFrame(void) {
+  memset(stats, 0, sizeof(stats));
+  if (heatmap)
+    memset(heatmap, 0, (uint32_t)WIDTH * HEIGHT);
+  depth = 0;
+  outer = PRIMITIVES;
+  outerStart = 0;
+}
+
+/**************************************************************************/
+/*!
+   @brief    A primitive was called. Calls made while another primitive is
+   drawing are counted, but their time and pixels go to the outermost one.
+   @param    p   The primitive
+*/
+/**************************************************************************/
+void GFXprofiler::enter(Primitive p) {
+  stats[p].calls++;
+  if (depth++ == 0) {
+    stats[p].topCalls++;
+    outer = p;
+    outerStart = micros();
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    A primitive returned
+   @param    p   The primitive, as passed to enter()
+*/
+/**************************************************************************/
+void GFXprofiler::leave(Primitive p) {
+  if (depth && --depth == 0) {
+    stats[p].micros += micros() - outerStart;
+    outer = PRIMITIVES;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    One pixel was written
+   @param    x   x coordinate, before rotation
+   @param    y   y coordinate, before rotation
+*/
+/**************************************************************************/
+void GFXprofiler::pixel(int16_t x, int16_t y) {
+  if ((x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
+    return;
+  // Writes from outside any primitive, e.g. print() into a canvas through
+  // drawPixel() directly, are charged to PIXEL
+  Stats &s = stats[outer == PRIMITIVES ? PIXEL : outer];
+  s.writes++;
+  if (!heatmap)
+    return;
+  uint8_t &n = heatmap[y * WIDTH + x];
+  if (n)
+    s.overdrawn++;
+  if (n < 255)
+    n++;
+}
+
+/**************************************************************************/
+/*!
+   @brief    A rect of pixels was written
+   @param    x   Left edge, before rotation
+   @param    y   Top edge, before rotation
+   @param    w   Width, before rotation
+   @param    h   Height, before rotation
+*/
+/**************************************************************************/
+void GFXprofiler::rect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  for (int16_t j = y; j < y + h; j++)
+    for (int16_t i = x; i < x + w; i++)
+      pixel(i, j);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Pixel writes this frame
+   @returns  Writes, counting every write to the same pixel
+*/
+/**************************************************************************/
+uint32_t GFXprofiler::writes(void) const {
+  uint32_t n = 0;
+  for (uint8_t p = 0; p < PRIMITIVES; p++)
+    n += stats[p].writes;
+  return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Pixel writes this frame that went to an already written pixel
+   @returns  Overdrawn writes
+*/
+/**************************************************************************/
+uint32_t GFXprofiler::overdraw(void) const {
+  uint32_t n = 0;
+  for (uint8_t p = 0; p < PRIMITIVES; p++)
+    n += stats[p].overdrawn;
+  return n;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Writes to one pixel this frame
+   @param    x   x coordinate, before rotation
+   @param    y   y coordinate, before rotation
+   @returns  The number of writes, saturating at 255
+*/
+/**************************************************************************/
+uint8_t GFXprofiler::heat(int16_t x, int16_t y) const {
+  if (!heatmap || (x < 0) || (y < 0) || (x >= WIDTH) || (y >= HEIGHT))
+    return 0;
+  return heatmap[y * WIDTH + x];
+}
+
+/**************************************************************************/
+/*!
+   @brief    Print the counts of this frame as a table, one row per primitive
+   that was called
+   @param    out Where to print it, e.g. Serial
+*/
+/**************************************************************************/
+void GFXprofiler::printTable(Print &out) const {
+  static const char *const names[PRIMITIVES] = {
+      "drawPixel",        "drawFastHLine",    "drawFastVLine",
+      "fillRect",         "fillScreen",       "drawLine",
+      "drawRect",         "drawCircle",       "drawCircleHelper",
+      "fillCircle",       "fillCircleHelper", "drawRoundRect",
+      "fillRoundRect",    "drawTriangle",     "fillTriangle",
+      "drawBitmap",       "drawChar",         "getTextBounds"};
+  char line[96];
+
+  snprintf(line, sizeof(line), "%-16s %7s %7s %9s %8s %9s\n", "primitive",
+           "calls", "top", "us", "writes", "overdrawn");
+  out.print(line);
+  for (uint8_t p = 0; p < PRIMITIVES; p++) {
+    const Stats &s = stats[p];
+    if (!s.calls && !s.writes)
+      continue;
+    snprintf(line, sizeof(line), "%-16s %7lu %7lu %9lu %8lu %9lu\n", names[p],
+             (unsigned long)s.calls, (unsigned long)s.topCalls,
+             (unsigned long)s.micros, (unsigned long)s.writes,
+             (unsigned long)s.overdrawn);
+    out.print(line);
+  }
+
+  uint32_t touched = 0, hottest = 0;
+  if (heatmap) {
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++) {
+      if (heatmap[i])
+        touched++;
+      if (heatmap[i] > hottest)
+        hottest = heatmap[i];
+    }
+  }
+  uint32_t total = writes();
+  snprintf(line, sizeof(line),
+           "%lu writes to %lu pixels, %lu%% overdraw, at most %lu per pixel\n",
+           (unsigned long)total, (unsigned long)touched,
+           (unsigned long)(total ? (uint64_t)overdraw() * 100 / total : 0),
+           (unsigned long)hottest);
+  out.print(line);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Write the writes per pixel of this frame as a PPM image: white
+   for untouched pixels, light gray for one write, then yellow, orange and
+   red for two, three and four or more
+   @param    path      File to write, on a host build or a mounted file system
+   @param    rotation  Rotation to draw the image in, as set on the display
+   @returns  True if the file was written
+*/
+/**************************************************************************/
+bool GFXprofiler::writeHeatmap(const char *path, uint8_t rotation) const {
+  static const uint8_t colors[5][3] = {{255, 255, 255},
+                                        {200, 200, 200},
+                                        {255, 220, 0},
+                                        {255, 128, 0},
+                                        {220, 0, 0}};
+  if (!heatmap)
+    return false;
+  FILE *file = fopen(path, "wb");
+  if (!file)
+    return false;
+
+  int16_t w = (rotation & 1) ? HEIGHT : WIDTH;
+  int16_t h = (rotation & 1) ? WIDTH : HEIGHT;
+  fprintf(file, "P6\n%d %d\n255\n", w, h);
+  for (int16_t y = 0; y < h; y++) {
+    for (int16_t x = 0; x < w; x++) {
+      // Same mapping as GFXcanvas1::drawPixel()
+      int16_t rx = x, ry = y;
+      switch (rotation & 3) {
+      case 1:
+        rx = WIDTH - 1 - y;
+        ry = x;
+        break;
+      case 2:
+        rx = WIDTH - 1 - x;
+        ry = HEIGHT - 1 - y;
+        break;
+      case 3:
+        rx = y;
+        ry = HEIGHT - 1 - x;
+        break;
+      }
+      uint8_t n = heatmap[ry * WIDTH + rx];
+      fwrite(colors[n < 4 ? n : 4], 1, 3, file);
+    }
+  }
+  return fclose(file) == 0;
+}
+#endif
@@ -9,6 +9,94 @@
 #endif
 #include "gfxfont.h"
 
+/// Clip rects that can be pushed on top of each other
+#define GFX_CLIP_DEPTH 4
+
+#ifdef GFX_PROFILE
+/// Draw call and overdraw profiler, compiled in with -DGFX_PROFILE. Attach
+/// one to a display with setProfiler(): every primitive entered is counted
+/// and timed, and every pixel a GFXcanvas1 writes is counted per raw pixel
+/// and charged to the outermost primitive that was drawing at the time.
+class GFXprofiler {
+public:
+  /// Primitives that are counted, in table order
+  enum Primitive : uint8_t {
+    PIXEL,
+    HLINE,
+    VLINE,
+    FILL_RECT,
+    FILL_SCREEN,
+    LINE,
+    RECT,
+    CIRCLE,
+    CIRCLE_HELPER,
+    FILL_CIRCLE,
+    FILL_CIRCLE_HELPER,
+    ROUND_RECT,
+    FILL_ROUND_RECT,
+    TRIANGLE,
+    FILL_TRIANGLE,
+    BITMAP,
+    CHAR,
+    TEXT_BOUNDS,
+    PRIMITIVES ///< Number of primitives, not one itself
+  };
+
+  GFXprofiler(uint16_t w, uint16_t h);
+  ~GFXprofiler(void);
+
+  void beginFrame(void);
+  void enter(Primitive p);
+  void leave(Primitive p);
+  void pixel(int16_t x, int16_t y);
+  void rect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  uint32_t writes(void) const;
+  uint32_t overdraw(void) const;
+  uint8_t heat(int16_t x, int16_t y) const;
+  void printTable(Print &out) const;
+  bool writeHeatmap(const char *path, uint8_t rotation = 0) const;
+
+private:
+  struct Stats {
+    uint32_t calls;     ///< Every entry, nested ones included
+    uint32_t topCalls;  ///< Entries with no other primitive active
+    uint32_t micros;    ///< Time spent in top level calls
+    uint32_t writes;    ///< Pixel writes charged to this primitive
+    uint32_t overdrawn; ///< Of those, writes to already written pixels
+  };
+
+  Stats stats[PRIMITIVES];
+  uint8_t *heatmap; ///< Writes per raw pixel this frame, saturating
+  uint16_t WIDTH, HEIGHT;
+  uint8_t depth;
+  Primitive outer;
+  uint32_t outerStart;
+};
+
+/// Scope guard that reports one primitive call to a profiler, if any
+class GFXprobe {
+public:
+  GFXprobe(GFXprofiler *p, GFXprofiler::Primitive prim) : p(p), prim(prim) {
+    if (p)
+      p->enter(prim);
+  }
+  ~GFXprobe(void) {
+    if (p)
+      p->leave(prim);
+  }
+
+private:
+  GFXprofiler *p;
+  GFXprofiler::Primitive prim;
+};
+
+/// Counts the enclosing function as a call of the given primitive
+#define GFX_PROBE(prim) GFXprobe gfxProbe(profiler, GFXprofiler::prim)
+#else
+#define GFX_PROBE(prim)
+#endif
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -39,6 +127,8 @@ public:
   virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                          uint16_t color);
+  virtual void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask,
+                             uint16_t color);
   virtual void endWrite(void);
 
   // CONTROL API
@@ -47,6 +137,12 @@ public:
   virtual void setRotation(uint8_t r);
   virtual void invertDisplay(bool i);
 
+  // CLIP API
+  // Drawing is limited to the intersection of the rects pushed. Subclasses
+  // that draw into several targets should pass pushes and pops on.
+  virtual bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+  virtual void popClipRect(void);
+
   // BASIC DRAW API
   // These MAY be overridden by the subclass to provide device-specific
   // optimized code.  Otherwise 'generic' versions are used.
@@ -62,6 +158,16 @@ public:
                         uint16_t color);
   virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
                         uint16_t color);
+  // 1-bit bitmaps, worth overriding in framebuffer-backed subclasses that
+  // can blit whole bytes instead of going through writePixel()
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color, uint16_t bg);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
@@ -78,14 +184,6 @@ public:
                      int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                      int16_t radius, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color, uint16_t bg);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color, uint16_t bg);
   void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
                    int16_t h, uint16_t color);
   void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
@@ -226,7 +324,63 @@ public:
   /************************************************************************/
   int16_t getCursorY(void) const { return cursor_y; };
 
+  /************************************************************************/
+  /*!
+    @brief      Get the custom font set with setFont()
+    @returns    Pointer to the font, or NULL for the built-in 5x7 font
+  */
+  /************************************************************************/
+  const GFXfont *getFont(void) const { return gfxFont; }
+
+  /************************************************************************/
+  /*!
+    @brief      Test a rect against the clip, for drawing code to skip work
+    @param  x   Left edge, accounting for current rotation
+    @param  y   Top edge, accounting for current rotation
+    @param  w   Width in pixels
+    @param  h   Height in pixels
+    @returns    True if nothing inside the rect can be drawn
+  */
+  /************************************************************************/
+  bool clipRejects(int16_t x, int16_t y, int16_t w, int16_t h) const {
+    return (w <= 0) || (h <= 0) || (x >= clipX1) || (y >= clipY1) ||
+           (x + w <= clipX0) || (y + h <= clipY0);
+  }
+
+#ifdef GFX_PROFILE
+  virtual void setProfiler(GFXprofiler *p);
+  /************************************************************************/
+  /*!
+    @brief      Get the profiler set with setProfiler()
+    @returns    Pointer to the profiler, or NULL when not profiling
+  */
+  /************************************************************************/
+  GFXprofiler *getProfiler(void) const { return profiler; }
+#endif
+
 protected:
+  bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+  /************************************************************************/
+  /*!
+    @brief      Test a pixel against the clip
+    @param  x   x coordinate, accounting for current rotation
+    @param  y   y coordinate, accounting for current rotation
+    @returns    True if the pixel may be drawn
+  */
+  /************************************************************************/
+  bool clipContains(int16_t x, int16_t y) const {
+    return (x >= clipX0) && (y >= clipY0) && (x < clipX1) && (y < clipY1);
+  }
+  void updateClip(void);
+  void writeSpan(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void writeCircleLines(int16_t x0, int16_t y0, int16_t t, int16_t h,
+                        uint8_t corners, int16_t delta, bool rows,
+                        uint16_t color);
+  void writeCircleRow(int16_t x0, int16_t y, int16_t w, uint8_t corners,
+                      uint16_t color);
+  void writeBitmapSpans(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                        int16_t h, uint16_t color, uint16_t bg, bool opaque,
+                        bool progmem);
   void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
                   int16_t *miny, int16_t *maxx, int16_t *maxy);
   int16_t WIDTH;        ///< This is the 'raw' display width - never changes
@@ -243,6 +397,15 @@ protected:
   bool wrap;            ///< If set, 'wrap' text at right edge of display
   bool _cp437;          ///< If set, use correct CP437 charset (default is off)
   GFXfont *gfxFont;     ///< Pointer to special font
+  int16_t clipX0;       ///< Left edge of the clip, in rotated coordinates
+  int16_t clipY0;       ///< Top edge of the clip, in rotated coordinates
+  int16_t clipX1;       ///< One past the right edge of the clip
+  int16_t clipY1;       ///< One past the bottom edge of the clip
+  int16_t clipStack[GFX_CLIP_DEPTH][4]; ///< Pushed clips, raw x, y, w, h
+  uint8_t clipDepth;                    ///< Number of clips pushed
+#ifdef GFX_PROFILE
+  GFXprofiler *profiler = NULL; ///< Receives draw calls and pixel writes
+#endif
 };
 
 /// A simple drawn button UI element
@@ -312,6 +475,17 @@ public:
   void fillScreen(uint16_t color);
   void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask,
+                     uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
   bool getPixel(int16_t x, int16_t y) const;
   /**********************************************************************/
   /*!
@@ -325,6 +499,13 @@ protected:
   bool getRawPixel(int16_t x, int16_t y) const;
   void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg, bool opaque);
+#ifdef GFX_PROFILE
+  void profileBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                     int16_t i0, int16_t j0, int16_t i1, int16_t j1,
+                     bool opaque);
+#endif
 
 private:
   uint8_t *buffer;
@@ -14,6 +14,20 @@ Currently this only extracts the printable 7-bit ASCII chars of a font.
 Will eventually extend with some int'l chars a la ftGFX, not there yet.
 Keep 7-bit fonts around as an option in that case, more compact.
 
+A subset of the range can be kept with -s, e.g. for a clock face:
+  ./fontconvert -s 0123456789: Outfit-ExtraBold.ttf 36 > Outfit_80036pt7b.h
+The first/last range is narrowed to the kept characters and any gaps in
+between get empty glyphs (no bitmap, zero advance), so the usual GFXfont
+lookup of glyph[c - first] still works.  Before/after sizes are reported
+on stderr.
+
+-r writes run-length encoded glyphs (GFXFONT_RLE, see gfxfont.h) instead
+of raw bits.  That roughly halves big display fonts but grows small text
+fonts, so only opt in where the report says it pays off.
+
+-R n stores the glyph bitmaps pre-rotated for setRotation(n), so text on
+a rotated display is written in panel order (GFXFONT_ROTATED).
+
 See notes at end for glyph nomenclature & other tidbits.
 */
 #ifndef ARDUINO
@@ -50,26 +64,89 @@ void enbit(uint8_t value) {
   }
 }
 
+// Byte-aligned output for run-length encoded glyphs
+void enbyte(uint8_t value) {
+  uint8_t bit;
+  for (bit = 0x80; bit; bit >>= 1)
+    enbit(value & bit);
+}
+
+// Returns the number of bytes written
+int enrun(int len) {
+  int n = 1;
+  for (; len >= 255; len -= 255, n++)
+    enbyte(255);
+  enbyte(len);
+  return n;
+}
+
+// Pixel at (x, y) of a glyph bitmap turned clockwise by `rotation`
+// quarter turns, which swaps width and height for odd rotations
+int glyphPixel(FT_Bitmap *bitmap, int rotation, int x, int y) {
+  int i = x, j = y, w = bitmap->width, h = bitmap->rows;
+  switch (rotation) {
+  case 1:
+    i = y;
+    j = h - 1 - x;
+    break;
+  case 2:
+    i = w - 1 - x;
+    j = h - 1 - y;
+    break;
+  case 3:
+    i = w - 1 - y;
+    j = x;
+    break;
+  }
+  return bitmap->buffer[j * bitmap->pitch + i / 8] & (0x80 >> (i & 7));
+}
+
 int main(int argc, char *argv[]) {
-  int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
+  int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y;
+  int fullBitmapSize = 0, subFirst, subLast;
+  int rle = 0, rotation = 0, on, run, sw, sh;
+  char *fontName, c, *ptr, *subset = NULL;
+  uint8_t keep[256];
   FT_Library library;
   FT_Face face;
   FT_Glyph glyph;
   FT_Bitmap *bitmap;
   FT_BitmapGlyphRec *g;
   GFXglyph *table;
-  uint8_t bit;
 
   // Parse command line.  Valid syntaxes are:
   //   fontconvert [filename] [size]
   //   fontconvert [filename] [size] [last char]
   //   fontconvert [filename] [size] [first char] [last char]
+  //   fontconvert -s [chars] [filename] [size] ...
+  //   fontconvert -r [filename] [size] ...
+  //   fontconvert -R [rotation] [filename] [size] ...
   // Unless overridden, default first and last chars are
   // ' ' (space) and '~', respectively
 
+  for (;;) {
+    if ((argc > 2) && !strcmp(argv[1], "-s")) {
+      subset = argv[2];
+      argv += 2;
+      argc -= 2;
+    } else if ((argc > 2) && !strcmp(argv[1], "-R")) {
+      rotation = atoi(argv[2]) & 3;
+      argv += 2;
+      argc -= 2;
+    } else if ((argc > 1) && !strcmp(argv[1], "-r")) {
+      rle = 1;
+      argv++;
+      argc--;
+    } else {
+      break;
+    }
+  }
+
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr,
+            "Usage: %s [-s chars] [-r] [-R rotation] fontfile size [first] "
+            "[last]\n",
+            argv[0]);
     return 1;
   }
 
@@ -88,6 +165,27 @@ int main(int argc, char *argv[]) {
     last = i;
   }
 
+  // Characters to emit, and the range they span
+  memset(keep, subset ? 0 : 1, sizeof(keep));
+  subFirst = subset ? last + 1 : first;
+  subLast = subset ? first - 1 : last;
+  for (ptr = subset; ptr && *ptr; ptr++) {
+    i = (uint8_t)*ptr;
+    if ((i < first) || (i > last)) {
+      fprintf(stderr, "Char 0x%02X not in range, skipped\n", i);
+      continue;
+    }
+    keep[i] = 1;
+    if (i < subFirst)
+      subFirst = i;
+    if (i > subLast)
+      subLast = i;
+  }
+  if (subLast < subFirst) {
+    fprintf(stderr, "Empty subset\n");
+    return 1;
+  }
+
   ptr = strrchr(argv[1], '/'); // Find last slash in filename
   if (ptr)
     ptr++; // First character of filename (path stripped)
@@ -145,6 +243,8 @@ int main(int argc, char *argv[]) {
   // the right symbols, and that's not done yet.
   // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
+  if (subset)
+    printf("// Subset: %s\n\n", subset);
   printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
   // Process glyphs and output huge bitmap data array
@@ -169,6 +269,15 @@ int main(int argc, char *argv[]) {
     bitmap = &face->glyph->bitmap;
     g = (FT_BitmapGlyphRec *)glyph;
 
+    // Every glyph of the range counts towards the full size, only
+    // the kept ones are written out
+    fullBitmapSize += (bitmap->width * bitmap->rows + 7) / 8;
+    if (!keep[i]) {
+      memset(&table[j], 0, sizeof(GFXglyph));
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
     // Minimal font and per-glyph information is stored to
     // reduce flash space requirements.  Glyph bitmaps are
     // fully bit-packed; no per-scanline pad, though end of
@@ -184,11 +293,35 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
-    for (y = 0; y < bitmap->rows; y++) {
-      for (x = 0; x < bitmap->width; x++) {
-        byte = x / 8;
-        bit = 0x80 >> (x & 7);
-        enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit);
+    // Stored size, the metrics above stay upright
+    sw = (rotation & 1) ? bitmap->rows : bitmap->width;
+    sh = (rotation & 1) ? bitmap->width : bitmap->rows;
+
+    if (rle) {
+      // Alternating clear/set runs, starting with clear, the last one
+      // ending on the final pixel
+      if (sw && sh) {
+        on = 0;
+        run = 0;
+        for (y = 0; y < sh; y++) {
+          for (x = 0; x < sw; x++) {
+            if (!glyphPixel(bitmap, rotation, x, y) != !on) {
+              bitmapOffset += enrun(run);
+              on = !on;
+              run = 0;
+            }
+            run++;
+          }
+        }
+        bitmapOffset += enrun(run);
+      }
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
+    for (y = 0; y < sh; y++) {
+      for (x = 0; x < sw; x++) {
+        enbit(glyphPixel(bitmap, rotation, x, y));
       }
     }
 
@@ -208,11 +341,11 @@ int main(int argc, char *argv[]) {
 
   // Output glyph attributes table (one per character)
   printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-  for (i = first, j = 0; i <= last; i++, j++) {
+  for (i = subFirst, j = subFirst - first; i <= subLast; i++, j++) {
     printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
            table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
            table[j].yOffset);
-    if (i < last) {
+    if (i < subLast) {
       printf(",   // 0x%02X", i);
       if ((i >= ' ') && (i <= '~')) {
         printf(" '%c'", i);
@@ -220,9 +353,9 @@ int main(int argc, char *argv[]) {
       putchar('\n');
     }
   }
-  printf(" }; // 0x%02X", last);
-  if ((last >= ' ') && (last <= '~'))
-    printf(" '%c'", last);
+  printf(" }; // 0x%02X", subLast);
+  if ((subLast >= ' ') && (subLast <= '~'))
+    printf(" '%c'", subLast);
   printf("\n\n");
 
   // Output font structure
@@ -231,15 +364,30 @@ int main(int argc, char *argv[]) {
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d", subFirst, subLast,
+           table[subFirst - first].height);
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
+    printf("  0x%02X, 0x%02X, %ld", subFirst, subLast,
            face->size->metrics.height >> 6);
   }
-  printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
+  if (rle || rotation) {
+    printf(", %s", rle ? "GFXFONT_RLE" : "GFXFONT_RAW");
+    if (rotation)
+      printf(" | GFXFONT_ROTATED(%d)", rotation);
+  }
+  printf(" };\n\n");
+  printf("// Approx. %d bytes\n",
+         bitmapOffset + (subLast - subFirst + 1) * 7 + 7);
   // Size estimate is based on AVR struct and pointer sizes;
   // actual size may vary.
 
+  if (subset || rle) {
+    fprintf(stderr, "%s: %d -> %d glyphs, approx. %d -> %d bytes\n",
+            fontName, last - first + 1, subLast - subFirst + 1,
+            fullBitmapSize + (last - first + 1) * 7 + 7,
+            bitmapOffset + (subLast - subFirst + 1) * 7 + 7);
+  }
+
   FT_Done_FreeType(library);
 
   return 0;
@@ -7,6 +7,25 @@
 #ifndef _GFXFONT_H_
 #define _GFXFONT_H_
 
+// Glyph bitmap encodings, see GFXfont->format.  RLE glyphs are a series
+// of run lengths over the width * height pixels in row order, alternating
+// clear and set and starting with clear.  Each run is one byte; a byte of
+// 255 adds 255 and continues the same run in the next byte.  Runs carry
+// on across rows.  Pays off for large fonts with thick strokes only.
+#define GFXFONT_RAW 0 ///< Bit-packed rows, MSB first, no per-row padding
+#define GFXFONT_RLE 1 ///< Run-length encoded, see above
+#define GFXFONT_ENCODING 0x0F ///< Encoding bits of GFXfont->format
+
+// Glyph bitmaps may also be stored pre-rotated for a display rotation, i.e.
+// turned clockwise by that many quarter turns (width and height swap for odd
+// ones).  At that rotation drawChar() writes them in panel order without
+// transforming every pixel, switching to rotation 0 around each glyph, so
+// this suits framebuffer displays with a cheap setRotation().  Glyph
+// metrics always stay upright.
+#define GFXFONT_ROTATED(r) (0x10 | (((r)&3) << 5)) ///< For setRotation(r)
+#define GFXFONT_IS_ROTATED(format) ((format)&0x10) ///< Pre-rotated font?
+#define GFXFONT_ROTATION(format) (((format) >> 5) & 3) ///< Its rotation
+
 /// Font data stored PER GLYPH
 typedef struct {
   uint16_t bitmapOffset; ///< Pointer into GFXfont->bitmap
@@ -24,6 +43,7 @@ typedef struct {
   uint16_t first;   ///< ASCII extents (first char)
   uint16_t last;    ///< ASCII extents (last char)
   uint8_t yAdvance; ///< Newline distance (y axis)
+  uint8_t format;   ///< Glyph bitmap encoding, GFXFONT_RAW if omitted
 } GFXfont;
 
 #endif // _GFXFONT_H_
@@ -0,0 +1,3 @@
+// The GFX core is built from lib/Adafruit-GFX, which [env:native] ignores as a library because its TFT and OLED
+// drivers need SPI and I2C
+#include "../../Adafruit-GFX/Adafruit_GFX.cpp"
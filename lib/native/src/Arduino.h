@@ -0,0 +1,78 @@
+#pragma once
+
+// Just enough of the ESP32 Arduino core to build the UI layer on the host. Time is virtual: delay() advances
+// millis() and micros() instead of sleeping, so screens that wait on hardware run through instantly.
+
+#include <algorithm>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Print.h"
+#include "WString.h"
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define ANALOG 0xC0
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef enum { GPIO_NUM_NC = -1, GPIO_NUM_MAX = 40 } gpio_num_t;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+// Pins read as released and the battery ADC as full scale
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+// Host only: `pin` reads `level` for the next `us` of virtual time and the other level after that
+void nativeDrivePin(uint8_t pin, int level, uint32_t us);
+// Host only: virtual time until a driven pin changes level, 0 if it is not driven
+uint32_t nativePinChangeUs(uint8_t pin);
+
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+int xPortGetCoreID();
+
+// Serial output goes to stdout
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,66 @@
+#include "ESP32Time.h"
+
+// Shared by every instance, like the SoC's RTC
+static int64_t epochOffsetUs = 1609459200LL * 1000000;
+
+static int64_t nowUs() { return epochOffsetUs + micros(); }
+
+static String format(const tm &time, const char *format) {
+  char str[128];
+  strftime(str, sizeof(str), format, &time);
+  return String(str);
+}
+
+ESP32Time::ESP32Time() {}
+
+void ESP32Time::setTime(long epoch, int ms) { epochOffsetUs = (int64_t)epoch * 1000000 + ms - micros(); }
+
+void ESP32Time::setTime(int sc, int mn, int hr, int dy, int mt, int yr, int ms) {
+  tm time = {};
+  time.tm_year = yr - 1900;
+  time.tm_mon = mt - 1;
+  time.tm_mday = dy;
+  time.tm_hour = hr;
+  time.tm_min = mn;
+  time.tm_sec = sc;
+  setTime(timegm(&time), ms);
+}
+
+tm ESP32Time::getTimeStruct() {
+  time_t epoch = getEpoch();
+  tm time;
+  gmtime_r(&epoch, &time);
+  return time;
+}
+
+String ESP32Time::getTime(String format) { return ::format(getTimeStruct(), format.c_str()); }
+String ESP32Time::getTime() { return format(getTimeStruct(), "%H:%M:%S"); }
+String ESP32Time::getDateTime(bool mode) { return format(getTimeStruct(), mode ? "%A, %B %d %Y %H:%M:%S" : "%a, %b %d %Y %H:%M:%S"); }
+String ESP32Time::getTimeDate(bool mode) { return format(getTimeStruct(), mode ? "%H:%M:%S %A, %B %d %Y" : "%H:%M:%S %a, %b %d %Y"); }
+String ESP32Time::getDate(bool mode) { return format(getTimeStruct(), mode ? "%A, %B %d %Y" : "%a, %b %d %Y"); }
+
+String ESP32Time::getAmPm(bool lowercase) {
+  bool pm = getTimeStruct().tm_hour >= 12;
+  if (lowercase)
+    return pm ? "pm" : "am";
+  return pm ? "PM" : "AM";
+}
+
+long ESP32Time::getEpoch() { return nowUs() / 1000000; }
+long ESP32Time::getMillis() { return nowUs() % 1000000 / 1000; }
+long ESP32Time::getMicros() { return nowUs() % 1000000; }
+int ESP32Time::getSecond() { return getTimeStruct().tm_sec; }
+int ESP32Time::getMinute() { return getTimeStruct().tm_min; }
+
+int ESP32Time::getHour(bool mode) {
+  int hour = getTimeStruct().tm_hour;
+  if (mode || hour <= 12)
+    return hour;
+  return hour - 12;
+}
+
+int ESP32Time::getDay() { return getTimeStruct().tm_mday; }
+int ESP32Time::getDayofWeek() { return getTimeStruct().tm_wday; }
+int ESP32Time::getDayofYear() { return getTimeStruct().tm_yday; }
+int ESP32Time::getMonth() { return getTimeStruct().tm_mon; }
+int ESP32Time::getYear() { return getTimeStruct().tm_year + 1900; }
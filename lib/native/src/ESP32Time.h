@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Arduino.h"
+
+// ESP32Time over a virtual clock that runs with micros(), so setting the time never touches the host's. Times are
+// UTC, like an ESP32 whose TZ was never set.
+class ESP32Time {
+public:
+  ESP32Time();
+  void setTime(long epoch = 1609459200, int ms = 0);
+  void setTime(int sc, int mn, int hr, int dy, int mt, int yr, int ms = 0);
+  tm getTimeStruct();
+  String getTime(String format);
+
+  String getTime();
+  String getDateTime(bool mode = false);
+  String getTimeDate(bool mode = false);
+  String getDate(bool mode = false);
+  String getAmPm(bool lowercase = false);
+
+  long getEpoch();
+  long getMillis();
+  long getMicros();
+  int getSecond();
+  int getMinute();
+  int getHour(bool mode = false);
+  int getDay();
+  int getDayofWeek();
+  int getDayofYear();
+  int getMonth();
+  int getYear();
+};
@@ -0,0 +1,190 @@
+#include "GxDEPG0150BN.h"
+
+#include "../esp_freertos_hooks.h"
+
+// The watch's driver gives up on BUSY after this long
+#define BUSY_TIMEOUT_US 10000000
+
+static void toNative(int16_t &x, int16_t &y, uint8_t rotation) {
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = GxDEPG0150BN_WIDTH - 1 - y;
+    y = t;
+    break;
+  case 2:
+    x = GxDEPG0150BN_WIDTH - 1 - x;
+    y = GxDEPG0150BN_HEIGHT - 1 - y;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = GxDEPG0150BN_HEIGHT - 1 - t;
+    break;
+  }
+}
+
+GxDEPG0150BN::GxDEPG0150BN(GxIO &io, int8_t rst, int8_t busy)
+    : GxEPD(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT), buffer(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT),
+      screen(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT), busyPin(busy) {
+  buffer.fillScreen(GxEPD_WHITE);
+  screen.fillScreen(GxEPD_WHITE);
+}
+
+void GxDEPG0150BN::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= width() || y < 0 || y >= height())
+    return;
+  toNative(x, y, getRotation());
+  buffer.drawPixel(x, y, color);
+}
+
+void GxDEPG0150BN::init(uint32_t serial_diag_bitrate) {}
+
+void GxDEPG0150BN::fillScreen(uint16_t color) { buffer.fillScreen(color); }
+
+void GxDEPG0150BN::update(void) {
+  memcpy(screen.getBuffer(), buffer.getBuffer(), GxDEPG0150BN_BUFFER_SIZE);
+  counters.spiBytes += GxDEPG0150BN_BUFFER_SIZE;
+  counters.fullRefreshes++;
+  counters.refreshedPixels += GxDEPG0150BN_WIDTH * GxDEPG0150BN_HEIGHT;
+  waitWhileBusy();
+}
+
+// Set bits are drawn in `color` and clear bits left alone. Only bm_invert is honoured.
+void GxDEPG0150BN::drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode) {
+  uint16_t rowBytes = (w + 7) / 8;
+  for (uint16_t j = 0; j < h; j++) {
+    for (uint16_t i = 0; i < w; i++) {
+      bool set = pgm_read_byte(&bitmap[j * rowBytes + i / 8]) & (0x80 >> (i & 7));
+      if (set != ((mode & bm_invert) != 0))
+        drawPixel(x + i, y + j, color);
+    }
+  }
+}
+
+void GxDEPG0150BN::drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode) {
+  uint8_t *data = buffer.getBuffer();
+  for (uint32_t i = 0; i < GxDEPG0150BN_BUFFER_SIZE; i++) {
+    uint8_t byte = i < size ? pgm_read_byte(&bitmap[i]) : 0xFF;
+    data[i] = (mode & bm_invert) ? ~byte : byte;
+  }
+  if (mode & bm_partial_update)
+    updateWindow(0, 0, GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT, false);
+  else
+    update();
+}
+
+void GxDEPG0150BN::eraseDisplay(bool using_partial_update) {
+  buffer.fillScreen(GxEPD_WHITE);
+  if (using_partial_update)
+    updateWindow(0, 0, GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT, false);
+  else
+    update();
+}
+
+void GxDEPG0150BN::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation) {
+  updateToWindow(x, y, x, y, w, h, using_rotation);
+}
+
+void GxDEPG0150BN::updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation) {
+  int16_t maxW = using_rotation ? width() : GxDEPG0150BN_WIDTH;
+  int16_t maxH = using_rotation ? height() : GxDEPG0150BN_HEIGHT;
+  if (xs >= maxW || ys >= maxH || xd >= maxW || yd >= maxH)
+    return;
+  w = min<uint16_t>(w, maxW - max(xs, xd));
+  h = min<uint16_t>(h, maxH - max(ys, yd));
+  if (using_rotation) {
+    uint16_t ws = w, hs = h;
+    rotateWindow(xs, ys, ws, hs);
+    rotateWindow(xd, yd, w, h);
+  }
+
+  // The controller addresses whole bytes horizontally
+  w = ((xs & 7) + w + 7) & ~7;
+  xs &= ~7;
+  xd &= ~7;
+  w = min<uint16_t>(w, GxDEPG0150BN_WIDTH - max(xs, xd));
+  copyWindow(xs, ys, xd, yd, w, h);
+
+  // The window is written again after the refresh, so that both controller buffers hold the new frame
+  counters.spiBytes += 2 * (w / 8) * h;
+  counters.partialRefreshes++;
+  counters.refreshedPixels += w * h;
+  waitWhileBusy();
+}
+
+void GxDEPG0150BN::powerDown() {}
+
+const GxDEPG0150BN::Stats &GxDEPG0150BN::stats() const { return counters; }
+
+void GxDEPG0150BN::resetStats() { counters = {}; }
+
+const uint8_t *GxDEPG0150BN::panel() const { return screen.getBuffer(); }
+
+void GxDEPG0150BN::setBusyTime(uint32_t us) { busyTimeUs = us; }
+
+void GxDEPG0150BN::waitWhileBusy() {
+  if (busyTimeUs == 0 || busyPin < 0)
+    return;
+
+  // Polled with delay(1), which hands the CPU to the idle task until the next tick
+  nativeDrivePin(busyPin, HIGH, busyTimeUs);
+  uint32_t start = micros();
+  while (digitalRead(busyPin) == HIGH && micros() - start < BUSY_TIMEOUT_US) {
+    nativeIdle();
+    delay(1);
+  }
+}
+
+bool GxDEPG0150BN::writePBM(const char *path) const {
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr)
+    return false;
+
+  fprintf(file, "P4\n%d %d\n", width(), height());
+  const uint8_t *pixels = panel();
+  for (int16_t y = 0; y < height(); y++) {
+    for (int16_t x = 0; x < width(); x += 8) {
+      uint8_t byte = 0;
+      for (int16_t bit = 0; bit < 8 && x + bit < width(); bit++) {
+        int16_t nx = x + bit, ny = y;
+        toNative(nx, ny, getRotation());
+        // PBM sets black pixels
+        if (!(pixels[ny * (GxDEPG0150BN_WIDTH / 8) + nx / 8] & (0x80 >> (nx & 7))))
+          byte |= 0x80 >> bit;
+      }
+      fputc(byte, file);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+void GxDEPG0150BN::rotateWindow(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h) const {
+  uint16_t t;
+  switch (getRotation()) {
+  case 1:
+    t = x;
+    x = GxDEPG0150BN_WIDTH - y - h;
+    y = t;
+    std::swap(w, h);
+    break;
+  case 2:
+    x = GxDEPG0150BN_WIDTH - x - w;
+    y = GxDEPG0150BN_HEIGHT - y - h;
+    break;
+  case 3:
+    t = x;
+    x = y;
+    y = GxDEPG0150BN_HEIGHT - t - w;
+    std::swap(w, h);
+    break;
+  }
+}
+
+void GxDEPG0150BN::copyWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h) {
+  const uint16_t rowBytes = GxDEPG0150BN_WIDTH / 8;
+  uint8_t *src = buffer.getBuffer(), *dst = screen.getBuffer();
+  for (uint16_t row = 0; row < h; row++)
+    memcpy(dst + (yd + row) * rowBytes + xd / 8, src + (ys + row) * rowBytes + xs / 8, w / 8);
+}
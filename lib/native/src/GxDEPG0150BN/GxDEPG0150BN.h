@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../GxEPD.h"
+#include "../GxIO/GxIO.h"
+
+#define GxDEPG0150BN_WIDTH 200
+#define GxDEPG0150BN_HEIGHT 200
+#define GxDEPG0150BN_BUFFER_SIZE (uint32_t(GxDEPG0150BN_WIDTH) * uint32_t(GxDEPG0150BN_HEIGHT) / 8)
+
+#define GxEPD_WIDTH GxDEPG0150BN_WIDTH
+#define GxEPD_HEIGHT GxDEPG0150BN_HEIGHT
+#define GxEPD_Class GxDEPG0150BN
+
+// Headless stand-in for the GxDEPG0150BN driver. Drawing goes into the driver's buffer as on the watch, update()
+// and updateWindow() copy it onto the panel, which can be dumped as a PBM. The pixel bytes the driver would clock
+// out over SPI and the refreshes it would trigger are counted. With setBusyTime() every refresh also holds BUSY
+// asserted, polled the way the driver on the watch waits for it.
+class GxDEPG0150BN : public GxEPD {
+public:
+  struct Stats {
+    uint32_t spiBytes;
+    uint16_t fullRefreshes;
+    uint16_t partialRefreshes;
+    uint32_t refreshedPixels;
+  };
+
+  GxDEPG0150BN(GxIO &io, int8_t rst = 9, int8_t busy = 7);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void init(uint32_t serial_diag_bitrate = 0);
+  void fillScreen(uint16_t color);
+  void update(void);
+  void drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = bm_normal);
+  void drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode = bm_normal);
+  using GxEPD::drawBitmap;
+  void eraseDisplay(bool using_partial_update = false);
+  void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true);
+  void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true);
+  void powerDown();
+
+  // Host only
+  const Stats &stats() const;
+  void resetStats();
+  // What the panel shows, in native orientation, 1 bits white
+  const uint8_t *panel() const;
+  // Writes what the panel shows as a binary PBM, turned the way the current rotation draws
+  bool writePBM(const char *path) const;
+  // Virtual time every refresh holds BUSY asserted, 0 (the default) to return at once
+  void setBusyTime(uint32_t us);
+
+private:
+  GFXcanvas1 buffer;
+  GFXcanvas1 screen;
+  Stats counters = {};
+  int8_t busyPin;
+  uint32_t busyTimeUs = 0;
+
+  void rotateWindow(uint16_t &x, uint16_t &y, uint16_t &w, uint16_t &h) const;
+  void copyWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h);
+  void waitWhileBusy();
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_DARKGREY 0x7BEF
+#define GxEPD_LIGHTGREY 0xC618
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_RED 0xF800
+
+// GxEPD's panel base class, with the same virtuals as GxEPD v3
+class GxEPD : public Adafruit_GFX {
+public:
+  enum bm_mode {
+    bm_normal = 0,
+    bm_default = 1,
+    bm_invert = (1 << 1),
+    bm_flip_x = (1 << 2),
+    bm_flip_y = (1 << 3),
+    bm_r90 = (1 << 4),
+    bm_r180 = (1 << 5),
+    bm_r270 = bm_r90 | bm_r180,
+    bm_partial_update = (1 << 6),
+    bm_invert_red = (1 << 7),
+    bm_transparent = (1 << 8)
+  };
+
+  GxEPD(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void init(uint32_t serial_diag_bitrate = 0) = 0;
+  virtual void fillScreen(uint16_t color) = 0;
+  virtual void update(void) = 0;
+  virtual void drawBitmap(const uint8_t *bitmap, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, int16_t mode = bm_normal) = 0;
+  virtual void drawBitmap(const uint8_t *bitmap, uint32_t size, int16_t mode = bm_normal) = 0;
+  virtual void eraseDisplay(bool using_partial_update = false) {}
+  virtual void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) = 0;
+  virtual void updateToWindow(uint16_t xs, uint16_t ys, uint16_t xd, uint16_t yd, uint16_t w, uint16_t h, bool using_rotation = true) = 0;
+  virtual void powerDown() = 0;
+  using Adafruit_GFX::drawBitmap;
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Arduino.h"
+
+// The virtual panel talks to nothing, so the IO classes only have to exist
+class GxIO {
+public:
+  virtual ~GxIO() {}
+};
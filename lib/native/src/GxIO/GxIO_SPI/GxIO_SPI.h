@@ -0,0 +1,11 @@
+#pragma once
+
+#include "../GxIO.h"
+#include "SPI.h"
+
+class GxIO_SPI : public GxIO {
+public:
+  GxIO_SPI(SPIClass &spi, int8_t cs, int8_t dc, int8_t rst = -1, int8_t bl = -1) {}
+};
+
+#define GxIO_Class GxIO_SPI
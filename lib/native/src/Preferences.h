@@ -0,0 +1,21 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "Arduino.h"
+
+// Preferences kept in memory for the run, shared by every namespace
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false) { return true; }
+  void end() {}
+
+  size_t putString(const char *key, const String &value);
+  String getString(const char *key, const String &defaultValue = String());
+  size_t putLong64(const char *key, int64_t value);
+  int64_t getLong64(const char *key, int64_t defaultValue = 0);
+
+private:
+  static std::map<std::string, std::string> values;
+};
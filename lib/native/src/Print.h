@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class String;
+
+// The subset of Arduino's Print the firmware and Adafruit GFX use
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str);
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long value);
+  size_t print(unsigned long value);
+  size_t print(int value) { return print((long)value); }
+  size_t print(unsigned int value) { return print((unsigned long)value); }
+  size_t print(double value, int digits = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(T value) { return print(value) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string>
+
+// Flash strings are plain strings on the host
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+// Arduino's String over std::string, with the constructors and operators the firmware uses
+class String {
+public:
+  String(const char *str = "") : str(str ? str : "") {}
+  String(const std::string &str) : str(str) {}
+  explicit String(char c) : str(1, c) {}
+  String(int value) : str(std::to_string(value)) {}
+  String(unsigned int value) : str(std::to_string(value)) {}
+  String(long value) : str(std::to_string(value)) {}
+  String(unsigned long value) : str(std::to_string(value)) {}
+  String(long long value) : str(std::to_string(value)) {}
+  String(unsigned long long value) : str(std::to_string(value)) {}
+  String(double value, unsigned int decimals = 2);
+
+  const char *c_str() const { return str.c_str(); }
+  unsigned int length() const { return str.size(); }
+  char operator[](unsigned int index) const { return index < str.size() ? str[index] : 0; }
+  long toInt() const { return atol(str.c_str()); }
+  void toCharArray(char *buffer, unsigned int size) const;
+
+  String &operator+=(const String &other) {
+    str += other.str;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) { return String(a.str + b.str); }
+  friend String operator+(const String &a, const char *b) { return String(a.str + (b ? b : "")); }
+  friend String operator+(const char *a, const String &b) { return String((a ? a : "") + b.str); }
+  friend bool operator==(const String &a, const String &b) { return a.str == b.str; }
+  friend bool operator!=(const String &a, const String &b) { return a.str != b.str; }
+
+private:
+  std::string str;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum { WIFI_OFF, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+// A radio that never finds a network
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t mode) { return true; }
+  int begin(const char *ssid, const char *passphrase = nullptr) { return 0; }
+  int begin(const String &ssid, const String &passphrase) { return 0; }
+  bool disconnect(bool wifiOff = false) { return true; }
+  bool beginSmartConfig() { return true; }
+  bool smartConfigDone() { return false; }
+  String SSID() const { return ""; }
+  String psk() const { return ""; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum {
+  GPIO_INTR_DISABLE,
+  GPIO_INTR_POSEDGE,
+  GPIO_INTR_NEGEDGE,
+  GPIO_INTR_ANYEDGE,
+  GPIO_INTR_LOW_LEVEL,
+  GPIO_INTR_HIGH_LEVEL
+} gpio_int_type_t;
+
+// One wake pin at a time, at GPIO_INTR_LOW_LEVEL or GPIO_INTR_HIGH_LEVEL, see esp_light_sleep_start()
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type);
+esp_err_t gpio_wakeup_disable(gpio_num_t pin);
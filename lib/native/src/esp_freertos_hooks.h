@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Arduino.h"
+
+typedef bool (*esp_freertos_idle_cb_t)();
+
+// There is no idle task on the host. Hooks are kept and run by nativeIdle(), which the virtual panel calls wherever
+// the watch's idle task would get the CPU.
+esp_err_t esp_register_freertos_idle_hook_for_cpu(esp_freertos_idle_cb_t hook, int cpu);
+void esp_deregister_freertos_idle_hook_for_cpu(esp_freertos_idle_cb_t hook, int cpu);
+
+// Host only
+void nativeIdle();
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP,
+  ESP_SLEEP_WAKEUP_GPIO
+} esp_sleep_source_t;
+
+// Light sleep skips virtual time until the timer fires or the GPIO wake pin reaches its level, whichever comes first
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source);
+esp_err_t esp_light_sleep_start();
+
+// Host only: light sleeps since the last reset, and the virtual time they took
+struct NativeSleepStats {
+  uint32_t lightSleeps;
+  uint64_t lightSleptUs;
+};
+const NativeSleepStats &nativeSleepStats();
+void nativeResetSleepStats();
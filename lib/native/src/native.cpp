@@ -0,0 +1,202 @@
+#include <chrono>
+#include <stdarg.h>
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "SPI.h"
+#include "WiFi.h"
+#include "driver/gpio.h"
+#include "esp_freertos_hooks.h"
+#include "esp_sleep.h"
+
+HardwareSerial Serial;
+SPIClass SPI;
+WiFiClass WiFi;
+std::map<std::string, std::string> Preferences::values;
+
+// Virtual time: the host clock plus every delay() that was skipped
+static const auto startTime = std::chrono::steady_clock::now();
+static uint64_t skippedUs = 0;
+
+unsigned long micros() {
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + skippedUs;
+}
+
+unsigned long millis() { return micros() / 1000; }
+void delay(uint32_t ms) { skippedUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { skippedUs += us; }
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) { return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin; }
+
+// Pins driven by nativeDrivePin(), the rest read HIGH
+struct DrivenPin {
+  bool driven;
+  int level;
+  uint64_t untilUs;
+};
+static DrivenPin pins[GPIO_NUM_MAX];
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) {}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= GPIO_NUM_MAX || !pins[pin].driven)
+    return HIGH;
+  return micros() < pins[pin].untilUs ? pins[pin].level : !pins[pin].level;
+}
+
+void nativeDrivePin(uint8_t pin, int level, uint32_t us) {
+  if (pin < GPIO_NUM_MAX)
+    pins[pin] = {true, level, micros() + us};
+}
+
+uint32_t nativePinChangeUs(uint8_t pin) {
+  if (pin >= GPIO_NUM_MAX || !pins[pin].driven)
+    return 0;
+  uint64_t now = micros();
+  return now < pins[pin].untilUs ? pins[pin].untilUs - now : 0;
+}
+uint16_t analogRead(uint8_t pin) { return 4095; }
+
+static uint32_t cpuMhz = 240;
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  cpuMhz = mhz;
+  return true;
+}
+uint32_t getCpuFrequencyMhz() { return cpuMhz; }
+int xPortGetCoreID() { return 1; }
+
+static esp_freertos_idle_cb_t idleHook = nullptr;
+
+esp_err_t esp_register_freertos_idle_hook_for_cpu(esp_freertos_idle_cb_t hook, int cpu) {
+  idleHook = hook;
+  return ESP_OK;
+}
+
+void esp_deregister_freertos_idle_hook_for_cpu(esp_freertos_idle_cb_t hook, int cpu) {
+  if (idleHook == hook)
+    idleHook = nullptr;
+}
+
+void nativeIdle() {
+  if (idleHook != nullptr)
+    idleHook();
+}
+
+static bool timerWakeup = false;
+static uint64_t timerWakeupUs = 0;
+static bool gpioWakeup = false;
+static int wakePin = -1;
+static int wakeLevel = LOW;
+static NativeSleepStats sleepStats = {};
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) {
+  wakePin = pin;
+  wakeLevel = type == GPIO_INTR_HIGH_LEVEL ? HIGH : LOW;
+  return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin) {
+  if (wakePin == pin)
+    wakePin = -1;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us) {
+  timerWakeup = true;
+  timerWakeupUs = us;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+  gpioWakeup = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+  if (source == ESP_SLEEP_WAKEUP_TIMER || source == ESP_SLEEP_WAKEUP_ALL)
+    timerWakeup = false;
+  if (source == ESP_SLEEP_WAKEUP_GPIO || source == ESP_SLEEP_WAKEUP_ALL)
+    gpioWakeup = false;
+  return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start() {
+  // Without a wake source that fires, the watch would not come back: return straight away instead
+  uint64_t us = timerWakeup ? timerWakeupUs : 0;
+  if (gpioWakeup && wakePin >= 0) {
+    uint32_t change = nativePinChangeUs(wakePin);
+    if (digitalRead(wakePin) == wakeLevel)
+      us = 0;
+    else if (change > 0 && (!timerWakeup || change < us))
+      us = change;
+  }
+  skippedUs += us;
+  sleepStats.lightSleeps++;
+  sleepStats.lightSleptUs += us;
+  return ESP_OK;
+}
+
+const NativeSleepStats &nativeSleepStats() { return sleepStats; }
+
+void nativeResetSleepStats() { sleepStats = {}; }
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t written = 0;
+  while (size--)
+    written += write(*buffer++);
+  return written;
+}
+
+size_t Print::print(const String &str) { return write(str.c_str()); }
+size_t Print::print(long value) { return print(String(value)); }
+size_t Print::print(unsigned long value) { return print(String(value)); }
+size_t Print::print(double value, int digits) { return print(String(value, digits)); }
+
+size_t Print::printf(const char *format, ...) {
+  char str[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(str, sizeof(str), format, args);
+  va_end(args);
+  if (length < 0)
+    return 0;
+  return write((const uint8_t *)str, min<size_t>(length, sizeof(str) - 1));
+}
+
+String::String(double value, unsigned int decimals) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  str = buffer;
+}
+
+void String::toCharArray(char *buffer, unsigned int size) const {
+  if (size == 0)
+    return;
+  strncpy(buffer, str.c_str(), size - 1);
+  buffer[size - 1] = 0;
+}
+
+size_t Preferences::putString(const char *key, const String &value) {
+  values[key] = value.c_str();
+  return value.length();
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) {
+  auto value = values.find(key);
+  return value == values.end() ? defaultValue : String(value->second);
+}
+
+size_t Preferences::putLong64(const char *key, int64_t value) {
+  values[key] = std::to_string(value);
+  return sizeof(value);
+}
+
+int64_t Preferences::getLong64(const char *key, int64_t defaultValue) {
+  auto value = values.find(key);
+  return value == values.end() ? defaultValue : strtoll(value->second.c_str(), nullptr, 10);
+}
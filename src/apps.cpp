@@ -7,7 +7,7 @@
 std::vector<std::unique_ptr<App>> apps;
 unsigned int currentAppIndex = 0;
 
-App::App(String name, const unsigned char *icon) {
+App::App(String name, const Asset *icon) {
   this->name = name;
   this->icon = icon;
 }
@@ -39,14 +39,13 @@ void drawAppsListUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus) {
   // Battery
   printRightString(display, String(String(batteryStatus) + "%").c_str(), 166, 22);
 
-  const unsigned char *icon_battery_small_array[6] = {epd_bitmap_icon_battery_0_small,  epd_bitmap_icon_battery_20_small,
-                                                      epd_bitmap_icon_battery_40_small, epd_bitmap_icon_battery_60_small,
-                                                      epd_bitmap_icon_battery_80_small, epd_bitmap_icon_battery_100_small};
-  display->drawBitmap(170, 2, icon_battery_small_array[batteryStatus / 20], 28, 28, GxEPD_BLACK);
+  const Asset *icon_battery_small_array[6] = {&icon_battery_0_small,  &icon_battery_20_small, &icon_battery_40_small,
+                                              &icon_battery_60_small, &icon_battery_80_small, &icon_battery_100_small};
+  drawAsset(display, 170, 2, *icon_battery_small_array[batteryStatus / 20], GxEPD_BLACK);
 
   // App
   display->drawRoundRect(46, 46, 108, 108, 10, GxEPD_BLACK);
   display->drawRoundRect(45, 45, 110, 110, 11, GxEPD_BLACK);
-  display->drawBitmap(50, 50, apps[currentAppIndex]->icon, 100, 100, GxEPD_BLACK);
+  drawAsset(display, 50, 50, *apps[currentAppIndex]->icon, GxEPD_BLACK);
   printCenterString(display, apps[currentAppIndex]->name.c_str(), 100, 185);
 }
\ No newline at end of file
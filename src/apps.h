@@ -7,6 +7,7 @@
 #include "memory"
 #include "vector"
 
+#include "lib/asset.h"
 #include "lib/ui.h"
 
 #include "resources/fonts/Outfit_60011pt7b.h"
@@ -15,11 +16,11 @@
 class App {
 public:
   String name;
-  const unsigned char *icon;
+  const Asset *icon;
   unsigned int iconWidth;
   unsigned int iconHeight;
 
-  App(String name, const unsigned char *icon);
+  App(String name, const Asset *icon);
   virtual void setup();
   virtual void drawUI(GxEPD_Class *display);
   virtual void exit();
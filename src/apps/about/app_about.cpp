@@ -5,11 +5,11 @@ void AppAbout::drawUI(GxEPD_Class *display) {
   display->setTextColor(GxEPD_BLACK);
   display->setTextWrap(false);
 
-  display->drawBitmap(50, 35, qpaperos_logo_100, 100, 100, GxEPD_BLACK);
+  drawAsset(display, 50, 35, qpaperos_logo_100, GxEPD_BLACK);
   display->setFont(&Outfit_60011pt7b);
-  printCenterString(display, "qpaperOS", 100, 170);
+  printString(display, "qpaperOS", 100, 170, TextAlign::CENTER, TEXT_EXTENT(Outfit_60011pt7bMetrics, "qpaperOS"));
 
   display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
 }
 
-std::unique_ptr<AppAbout> appAbout(new AppAbout("About", icon_app_about));
\ No newline at end of file
+std::unique_ptr<AppAbout> appAbout(new AppAbout("About", &icon_app_about));
\ No newline at end of file
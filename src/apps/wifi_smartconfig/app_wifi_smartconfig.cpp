@@ -9,12 +9,12 @@ void AppWiFiSmartconfig::drawUI(GxEPD_Class *display) {
   display->fillScreen(GxEPD_WHITE);
   display->setTextColor(GxEPD_BLACK);
   display->setFont(&Outfit_60011pt7b);
-  display->drawBitmap(50, 20, icon_app_wifi_smartconfig, 100, 100, GxEPD_BLACK);
+  drawAsset(display, 50, 20, icon_app_wifi_smartconfig, GxEPD_BLACK);
 
   int timer = 0;
 
   if (!done) {
-    printCenterString(display, "Waiting connection...", 100, 150);
+    printString(display, "Waiting connection...", 100, 150, TextAlign::CENTER, TEXT_EXTENT(Outfit_60011pt7bMetrics, "Waiting connection..."));
     display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
 
     WiFi.disconnect();
@@ -27,7 +27,7 @@ void AppWiFiSmartconfig::drawUI(GxEPD_Class *display) {
 
       if (WiFi.smartConfigDone()) {
         display->fillRect(0, 130, GxEPD_WIDTH, 50, GxEPD_WHITE);
-        printCenterString(display, String("Connected!").c_str(), 100, 150);
+        printString(display, "Connected!", 100, 150, TextAlign::CENTER, TEXT_EXTENT(Outfit_60011pt7bMetrics, "Connected!"));
         printCenterString(display, WiFi.SSID().c_str(), 100, 175);
         display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
         preferences.putString("wifi_ssid", WiFi.SSID());
@@ -38,7 +38,7 @@ void AppWiFiSmartconfig::drawUI(GxEPD_Class *display) {
 
     if (timer >= 500) {
       display->fillRect(0, 130, GxEPD_WIDTH, 50, GxEPD_WHITE);
-      printCenterString(display, "Connection failed", 100, 150);
+      printString(display, "Connection failed", 100, 150, TextAlign::CENTER, TEXT_EXTENT(Outfit_60011pt7bMetrics, "Connection failed"));
       display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
 
       String wifi_ssid = preferences.getString("wifi_ssid", "");
@@ -55,4 +55,4 @@ void AppWiFiSmartconfig::drawUI(GxEPD_Class *display) {
 
 void AppWiFiSmartconfig::exit() { preferences.end(); }
 
-std::unique_ptr<AppWiFiSmartconfig> appWiFiSmartconfig(new AppWiFiSmartconfig("Connect to WiFi", icon_app_wifi_smartconfig));
\ No newline at end of file
+std::unique_ptr<AppWiFiSmartconfig> appWiFiSmartconfig(new AppWiFiSmartconfig("Connect to WiFi", &icon_app_wifi_smartconfig));
\ No newline at end of file
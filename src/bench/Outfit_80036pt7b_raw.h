@@ -0,0 +1,226 @@
+#pragma once
+
+#include "lib/fontmetrics.h"
+
+// Outfit_80036pt7b with its glyphs decoded back to raw packed bits, for comparing the raw and RLE formats in the
+// benchmarks. Same subset (0123456789:) and panel orientation.
+
+const uint8_t Outfit_80036pt7bRawBitmaps[] PROGMEM = {
+    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xF8, 0x00, 0x00,
+    0x01, 0xFF, 0xE7, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+    0xFE, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE7, 0xFF, 0xC0, 0x00, 0x00,
+    0x3F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE3, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xFE,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x7F, 0xE0, 0x00, 0x00, 0x01, 0xFC, 0x0F,
+    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xC1, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFC,
+    0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x87, 0xFF, 0xE0, 0x00, 0x01, 0xFF,
+    0xF8, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x03,
+    0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xFF, 0xE0, 0x00,
+    0x03, 0xFF, 0xEF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xFF, 0xE0,
+    0x00, 0x03, 0xFF, 0xBF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xF7, 0xFF, 0xFF,
+    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+    0xFF, 0xDF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0xFF,
+    0xF7, 0xFF, 0x1F, 0xFF, 0xF0, 0x3F, 0xFE, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xDF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x81, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0x01, 0xFF,
+    0xFF, 0xFF, 0xF9, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F, 0xF8, 0x01,
+    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0xFF, 0xE0,
+    0x01, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0xFE, 0x03, 0xFF,
+    0x80, 0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x0F,
+    0xFE, 0x00, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,
+    0x00, 0x7F, 0xF1, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xF0, 0x00,
+    0x00, 0x01, 0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0xFF, 0xF0,
+    0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF,
+    0x00, 0x00, 0x00, 0x1F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xBF,
+    0xF8, 0x00, 0x7F, 0x00, 0x7F, 0xF7, 0xFF, 0x00, 0x0F, 0xF8, 0x0F, 0xFE,
+    0xFF, 0xC0, 0x01, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x3F,
+    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x87, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF8,
+    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0x00,
+    0x7F, 0xFF, 0xFF, 0xFB, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xF1,
+    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
+    0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F,
+    0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x00,
+    0x0F, 0xFC, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x1F, 0xFF, 0xC0,
+    0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x3F, 0xF9, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x0F,
+    0xFF, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x00,
+    0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xE0,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00,
+    0x0E, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xF0,
+    0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
+    0xBF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0x00, 0x07, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFE, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xC0, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0xFF, 0x80, 0x01,
+    0xFF, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x7F, 0xFF, 0xFF, 0x00,
+    0x0F, 0xFC, 0x0F, 0xFE, 0xFF, 0xE0, 0x01, 0xFF, 0x81, 0xFF, 0xDF, 0xFE,
+    0x00, 0x7F, 0xF0, 0x3F, 0xFB, 0xFF, 0xE0, 0x1F, 0xFE, 0x07, 0xFF, 0x7F,
+    0xFF, 0x0F, 0xFF, 0xC0, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFC,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x01,
+    0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xF8, 0x3F, 0xFF, 0xFF, 0xE0,
+    0x07, 0xFF, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE,
+    0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x07,
+    0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x7F, 0xFF, 0xFC, 0x03, 0xFF, 0x80,
+    0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x1F, 0xFC,
+    0x00, 0x0F, 0xFF, 0xFF, 0xF3, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF3, 0xFF,
+    0xFB, 0xFF, 0x80, 0x07, 0xFE, 0x1F, 0xFF, 0x7F, 0xF8, 0x01, 0xFF, 0xC1,
+    0xFF, 0xEF, 0xFF, 0xC0, 0x7F, 0xF8, 0x1F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF3, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x7E, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xC7, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x78, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0x07, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x20, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
+    0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x00,
+    0x7F, 0xFF, 0xF8, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC,
+    0x00, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xEF, 0xFF,
+    0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFC,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x00, 0x7F, 0xFE, 0x1F, 0xFE, 0x7F,
+    0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xEF, 0xFE, 0x00, 0x3F, 0xF0, 0x07, 0xFF,
+    0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x1F, 0xF0, 0x03,
+    0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x1F, 0xF0,
+    0x07, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xF7, 0xFF, 0x00, 0x3F,
+    0xF8, 0x0F, 0xFF, 0x7F, 0xF0, 0x07, 0xFF, 0xC1, 0xFF, 0xE7, 0xFF, 0x80,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x81, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xE7, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x81,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
+    0x20, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xF0, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x07, 0xFF, 0xFF,
+    0xFF, 0xE3, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x80, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xCF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC0, 0xFF,
+    0xF0, 0x0F, 0xFF, 0xBF, 0xFC, 0x1F, 0xFC, 0x00, 0xFF, 0xF7, 0xFF, 0xE3,
+    0xFF, 0x00, 0x0F, 0xFE, 0xFF, 0xFE, 0x7F, 0xC0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF7, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFE,
+    0x7F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xC3, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x01, 0xFF, 0xFF, 0xF0, 0x03,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x07, 0xFE, 0x00, 0x3F, 0xF1, 0xFF, 0xE0,
+    0x0F, 0xFF, 0x3F, 0xFE, 0x03, 0xFF, 0xE7, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
+    0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF,
+    0xFF, 0xFC, 0x07, 0xFF, 0xEF, 0xFF, 0x80, 0xFF, 0xF9, 0xFF, 0xE0, 0x0F,
+    0xFF, 0x1F, 0xFC, 0x00, 0xFF, 0xC1, 0xFE, 0x00, 0x0F, 0xF0, 0x06, 0x00,
+    0x00, 0x30, 0x00};
+
+constexpr GFXglyph Outfit_80036pt7bRawGlyphs[] PROGMEM = {
+    {0, 43, 52, 47, 2, -50},      // 0x30 '0'
+    {280, 22, 50, 28, 1, -49},    // 0x31 '1'
+    {418, 38, 51, 41, 1, -50},    // 0x32 '2'
+    {661, 37, 51, 40, 1, -49},    // 0x33 '3'
+    {897, 41, 50, 43, 1, -49},    // 0x34 '4'
+    {1154, 37, 51, 40, 1, -49},   // 0x35 '5'
+    {1390, 38, 51, 41, 1, -49},   // 0x36 '6'
+    {1633, 35, 50, 37, 1, -49},   // 0x37 '7'
+    {1852, 36, 52, 40, 2, -50},   // 0x38 '8'
+    {2086, 38, 51, 41, 1, -50},   // 0x39 '9'
+    {2329, 14, 35, 21, 4, -33}};  // 0x3A ':'
+
+const GFXfont Outfit_80036pt7bRaw PROGMEM = {(uint8_t *)Outfit_80036pt7bRawBitmaps, (GFXglyph *)Outfit_80036pt7bRawGlyphs, 0x30, 0x3A, 89,
+                                             GFXFONT_RAW | GFXFONT_ROTATED(1)};
+
+// Approx. 2475 bytes
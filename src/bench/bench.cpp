@@ -0,0 +1,181 @@
+#include "bench.h"
+
+#ifdef ESP32
+typedef uint32_t BenchTicks;
+static BenchTicks benchTicks() { return ESP.getCycleCount(); }
+static double ticksToNs(uint64_t ticks) { return ticks * 1000.0 / getCpuFrequencyMhz(); }
+#else
+#include <chrono>
+typedef uint64_t BenchTicks;
+static BenchTicks benchTicks() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+static double ticksToNs(uint64_t ticks) { return ticks; }
+#endif
+
+void BenchDisplay::cover(int16_t x, int16_t y, int16_t w, int16_t h) {
+  // Only what is left of it inside the clip reaches the frame
+  if (clipRect(x, y, w, h))
+    pixels += w * h;
+}
+
+void BenchDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, 1, 1);
+  FrameDisplay::drawPixel(x, y, color);
+}
+
+void BenchDisplay::startWrite() {
+  virtualCalls++;
+  FrameDisplay::startWrite();
+}
+
+void BenchDisplay::writePixel(int16_t x, int16_t y, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::writePixel(x, y, color);
+}
+
+void BenchDisplay::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::writeFillRect(x, y, w, h, color);
+}
+
+void BenchDisplay::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::writeFastVLine(x, y, h, color);
+}
+
+void BenchDisplay::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::writeFastHLine(x, y, w, color);
+}
+
+void BenchDisplay::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::writeLine(x0, y0, x1, y1, color);
+}
+
+void BenchDisplay::writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) {
+  virtualCalls++;
+  // Set bits of the part of the span inside the clip
+  int16_t cx = x, cy = y, cw = w, ch = 1;
+  if (clipRect(cx, cy, cw, ch)) {
+    uint32_t inside = (0xFFFFFFFFUL >> (cx - x)) & ~(0xFFFFFFFFUL >> (cx - x + cw - 1) >> 1);
+    pixels += __builtin_popcount(mask & inside);
+  }
+  FrameDisplay::writeSpanMask(x, y, w, mask, color);
+}
+
+void BenchDisplay::endWrite() {
+  virtualCalls++;
+  FrameDisplay::endWrite();
+}
+
+void BenchDisplay::fillScreen(uint16_t color) {
+  virtualCalls++;
+  cover(0, 0, width(), height());
+  FrameDisplay::fillScreen(color);
+}
+
+void BenchDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, w, h);
+  FrameDisplay::fillRect(x, y, w, h, color);
+}
+
+void BenchDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, 1, h);
+  FrameDisplay::drawFastVLine(x, y, h, color);
+}
+
+void BenchDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, w, 1);
+  FrameDisplay::drawFastHLine(x, y, w, color);
+}
+
+void BenchDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::drawLine(x0, y0, x1, y1, color);
+}
+
+void BenchDisplay::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  virtualCalls++;
+  FrameDisplay::drawRect(x, y, w, h, color);
+}
+
+void BenchDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, w, h);
+  FrameDisplay::drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void BenchDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  virtualCalls++;
+  cover(x, y, w, h);
+  FrameDisplay::drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+void BenchDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  virtualCalls++;
+  cover(x, y, w, h);
+  FrameDisplay::drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void BenchDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  virtualCalls++;
+  cover(x, y, w, h);
+  FrameDisplay::drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+void BenchDisplay::setRotation(uint8_t r) {
+  virtualCalls++;
+  FrameDisplay::setRotation(r);
+}
+
+bool BenchDisplay::pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  virtualCalls++;
+  return FrameDisplay::pushClipRect(x, y, w, h);
+}
+
+void BenchDisplay::popClipRect() {
+  virtualCalls++;
+  FrameDisplay::popClipRect();
+}
+
+size_t BenchDisplay::write(uint8_t c) {
+  virtualCalls++;
+  return FrameDisplay::write(c);
+}
+
+void BenchDisplay::update() {}
+
+void BenchDisplay::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation) {}
+
+void runBenchmarks(BenchDisplay *display, const Benchmark *benchmarks, size_t count, const char *filter) {
+  Serial.printf("%-24s %8s %12s %10s %10s\n", "benchmark", "iters", "ns/op", "pixels/op", "vcalls/op");
+  for (size_t i = 0; i < count; i++) {
+    const Benchmark &benchmark = benchmarks[i];
+    if (strstr(benchmark.name, filter) == nullptr)
+      continue;
+
+    benchmark.run(display, 0);
+    display->virtualCalls = 0;
+    display->pixels = 0;
+    uint64_t ticks = 0;
+    for (uint32_t iteration = 0; iteration < benchmark.iterations; iteration++) {
+      BenchTicks start = benchTicks();
+      benchmark.run(display, iteration);
+      ticks += (BenchTicks)(benchTicks() - start);
+    }
+    if (benchmark.count != nullptr) {
+      for (uint32_t iteration = 0; iteration < benchmark.iterations; iteration++)
+        benchmark.count(display, iteration);
+    }
+
+    double iterations = benchmark.iterations;
+    Serial.printf("%-24s %8u %12.0f %10.1f %10.1f\n", benchmark.name, (unsigned)benchmark.iterations, ticksToNs(ticks) / iterations,
+                  display->pixels / iterations, display->virtualCalls / iterations);
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lib/display.h"
+
+// FrameDisplay that counts the virtual draw calls made on it and the pixels covered by the ones that reach the frame.
+// update() and updateWindow() are dropped, so that only rendering is measured.
+class BenchDisplay : public FrameDisplay {
+public:
+  using FrameDisplay::FrameDisplay;
+
+  uint32_t virtualCalls = 0;
+  uint32_t pixels = 0;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void startWrite() override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+  void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) override;
+  void endWrite() override;
+  void fillScreen(uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  using FrameDisplay::drawBitmap;
+  void setRotation(uint8_t r) override;
+  bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) override;
+  void popClipRect() override;
+  size_t write(uint8_t c) override;
+  using FrameDisplay::write;
+
+  void update() override;
+  void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) override;
+
+private:
+  void cover(int16_t x, int16_t y, int16_t w, int16_t h);
+};
+
+struct Benchmark {
+  const char *name;
+  uint32_t iterations;
+  void (*run)(BenchDisplay *display, uint32_t iteration);
+  // For rows that bypass BenchDisplay: the same op again, untimed, counting its pixels into BenchDisplay::pixels
+  void (*count)(BenchDisplay *display, uint32_t iteration);
+};
+
+// Runs every benchmark whose name contains `filter` once to warm up, then `iterations` times, and prints the time,
+// pixels and virtual calls per op to Serial. Time comes from the cycle counter on the watch, the steady clock elsewhere.
+void runBenchmarks(BenchDisplay *display, const Benchmark *benchmarks, size_t count, const char *filter = "");
@@ -0,0 +1,289 @@
+#include "ESP32Time.h"
+#include "GxIO/GxIO_SPI/GxIO_SPI.h"
+
+#include "apps.h"
+#include "bench/Outfit_80036pt7b_raw.h"
+#include "bench/bench.h"
+#include "home.h"
+#include "lib/renderer.h"
+#include "os_config.h"
+#include "resources/app_icons.h"
+#include "resources/fonts/Outfit_60011pt7b.h"
+#include "resources/fonts/Outfit_80036pt7b.h"
+
+// Entry point of [env:bench] and [env:bench_esp32dev]: times every screen and the GFX primitives they are built from,
+// so that changes to the render path show up as a different table
+
+RTC_DATA_ATTR uint8_t panelFrame[FRAME_BUFFER_SIZE];
+
+GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
+BenchDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
+
+ESP32Time rtc;
+static DisplayListState homeList;
+static LayerState homeLayer;
+static App *appAboutInstance = nullptr;
+
+// The devirtualized renderer over the same frame, at the rotation the firmware draws in. It bypasses BenchDisplay, so
+// its rows make no virtual calls, and their pixels come from running them once more through CountingRenderer.
+typedef FrameRenderer<GxEPD_WIDTH, GxEPD_HEIGHT, 1> BenchRenderer;
+static BenchRenderer *renderer = nullptr;
+
+// BenchRenderer that adds what reaches the frame to BenchDisplay::pixels: the area of fills and the set bits of masks,
+// the same way BenchDisplay counts its own calls
+class CountingRenderer : public Renderer<CountingRenderer> {
+public:
+  static constexpr uint8_t ROTATION = BenchRenderer::ROTATION;
+
+  CountingRenderer(uint8_t *buffer, uint32_t *pixels) : frame(buffer), pixels(pixels) {}
+
+  static constexpr int16_t width() { return BenchRenderer::width(); }
+  static constexpr int16_t height() { return BenchRenderer::height(); }
+  static void toNative(int16_t x, int16_t y, int16_t w, int16_t h, int16_t &nx, int16_t &ny, int16_t &nw, int16_t &nh) {
+    BenchRenderer::toNative(x, y, w, h, nx, ny, nw, nh);
+  }
+
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w < 0) {
+      w = -w;
+      x -= w - 1;
+    }
+    if (h < 0) {
+      h = -h;
+      y -= h - 1;
+    }
+    int16_t nx, ny, nw, nh;
+    toNative(x, y, w, h, nx, ny, nw, nh);
+    fillNative(nx, ny, nw, nh, color);
+  }
+
+  void fillNative(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int16_t w0 = min(x + w, GxEPD_WIDTH) - max(x, (int16_t)0), h0 = min(y + h, GxEPD_HEIGHT) - max(y, (int16_t)0);
+    if (w0 > 0 && h0 > 0)
+      *pixels += w0 * h0;
+    frame.fillNative(x, y, w, h, color);
+  }
+
+  void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) {
+    if (y >= 0 && y < height()) {
+      for (int16_t i = 0; i < w && i < 32; i++)
+        if ((mask & (0x80000000UL >> i)) && x + i >= 0 && x + i < width())
+          (*pixels)++;
+    }
+    frame.writeSpanMask(x, y, w, mask, color);
+  }
+
+private:
+  BenchRenderer frame;
+  uint32_t *pixels;
+};
+
+static CountingRenderer *counter = nullptr;
+
+// A (static) row: timed on BenchRenderer, then counted on CountingRenderer. `draw` takes either renderer.
+#define STATIC_BENCHMARK(name, iterations, draw)                                                                                                 \
+  { name, iterations, [](BenchDisplay *, uint32_t) { draw(renderer); }, [](BenchDisplay *, uint32_t) { draw(counter); } }
+
+static const int benchBattery = 87;
+
+static void benchHomeBackground(BenchDisplay *display, uint32_t iteration) {
+  display->fillScreen(GxEPD_WHITE);
+  drawHomeBackground(display);
+}
+
+static void benchHomeWidgets(BenchDisplay *display, uint32_t iteration) {
+  display->fillScreen(GxEPD_WHITE);
+  drawHomeUI(display, &rtc, benchBattery);
+}
+
+// The same screen redrawn into a window around the minute digits only
+static void benchHomeWidgetsClipped(BenchDisplay *display, uint32_t iteration) {
+  display->pushClipRect(110, 70, 80, 60);
+  display->fillScreen(GxEPD_WHITE);
+  drawHomeUI(display, &rtc, benchBattery);
+  display->popClipRect();
+}
+
+// The per-minute path: the widgets as a display list over the background layer, one minute later every time
+static void benchHomeMinute(BenchDisplay *display, uint32_t iteration) {
+  rtc.setTime(0, iteration % 60, 12, 3, 6, 2024);
+  display->beginList(&homeList, true);
+  drawHomeUI(display, &rtc, benchBattery);
+  DirtyRegions dirty;
+  display->endList(&dirty);
+}
+
+static void benchAppsList(BenchDisplay *display, uint32_t iteration) { drawAppsListUI(display, &rtc, benchBattery); }
+
+static void benchAbout(BenchDisplay *display, uint32_t iteration) { appAboutInstance->drawUI(display); }
+
+static void benchFillRect(BenchDisplay *display, uint32_t iteration) { display->fillRect(20, 20, 160, 160, GxEPD_BLACK); }
+
+template <class R> static void benchFillRectStatic(R *renderer) { renderer->fillRect(20, 20, 160, 160, GxEPD_BLACK); }
+
+static void benchDrawLine(BenchDisplay *display, uint32_t iteration) { display->drawLine(0, 10, 199, 150, GxEPD_BLACK); }
+
+static void benchDrawRoundRect(BenchDisplay *display, uint32_t iteration) { display->drawRoundRect(45, 45, 110, 110, 11, GxEPD_BLACK); }
+
+static void benchFillRoundRect(BenchDisplay *display, uint32_t iteration) { display->fillRoundRect(45, 45, 110, 110, 11, GxEPD_BLACK); }
+
+template <class R> static void benchDrawRoundRectStatic(R *renderer) { renderer->drawRoundRect(45, 45, 110, 110, 11, GxEPD_BLACK); }
+
+template <class R> static void benchFillRoundRectStatic(R *renderer) { renderer->fillRoundRect(45, 45, 110, 110, 11, GxEPD_BLACK); }
+
+static void benchFillCircle(BenchDisplay *display, uint32_t iteration) { display->fillCircle(100, 100, 60, GxEPD_BLACK); }
+
+template <class R> static void benchFillCircleStatic(R *renderer) { renderer->fillCircle(100, 100, 60, GxEPD_BLACK); }
+
+static void benchFillTriangle(BenchDisplay *display, uint32_t iteration) { display->fillTriangle(10, 190, 100, 10, 190, 170, GxEPD_BLACK); }
+
+static void benchDrawBitmap(BenchDisplay *display, uint32_t iteration) {
+  display->drawBitmap(86, 86, icon_wifi_small.data, icon_wifi_small.width, icon_wifi_small.height, GxEPD_BLACK);
+}
+
+// What drawBitmap did before it blitted whole bytes: one writePixel per set bit, the loop of Adafruit_GFX. It draws the
+// same icon as the row above, so the two ns/op compare directly; its pixels are the set bits only, not the whole icon.
+static void benchDrawBitmapPerPixel(BenchDisplay *display, uint32_t iteration) {
+  const int16_t x = 86, y = 86, w = icon_wifi_small.width, h = icon_wifi_small.height;
+  const int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+  display->startWrite();
+  for (int16_t j = 0; j < h; j++) {
+    for (int16_t i = 0; i < w; i++) {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = pgm_read_byte(&icon_wifi_small.data[j * byteWidth + i / 8]);
+      if (b & 0x80)
+        display->writePixel(x + i, y + j, GxEPD_BLACK);
+    }
+  }
+  display->endWrite();
+}
+
+template <class R> static void benchDrawBitmapStatic(R *renderer) {
+  renderer->drawBitmap(86, 86, icon_wifi_small.data, icon_wifi_small.width, icon_wifi_small.height, GxEPD_BLACK);
+}
+
+static void benchDrawAssetRle(BenchDisplay *display, uint32_t iteration) { drawAsset(display, 50, 50, icon_app_about, GxEPD_BLACK); }
+
+template <class R> static void benchDrawAssetRleStatic(R *renderer) { renderer->drawAsset(50, 50, icon_app_about, GxEPD_BLACK); }
+
+static void benchDrawChar(BenchDisplay *display, uint32_t iteration) {
+  display->setFont(&Outfit_80036pt7b);
+  display->drawChar(70, 125, '8', GxEPD_BLACK, GxEPD_WHITE, 1);
+}
+
+template <class R> static void benchDrawCharStatic(R *renderer) {
+  renderer->setFont(&Outfit_80036pt7b);
+  renderer->drawChar(70, 125, '8', GxEPD_BLACK);
+}
+
+// The clock digits in either encoding of the same font; they draw the same pixels
+static void benchClock(BenchDisplay *display, const GFXfont *font) {
+  display->setFont(font);
+  display->setCursor(10, 125);
+  display->print("12:34");
+}
+
+static void benchClockRaw(BenchDisplay *display, uint32_t iteration) { benchClock(display, &Outfit_80036pt7bRaw); }
+
+static void benchClockRle(BenchDisplay *display, uint32_t iteration) { benchClock(display, &Outfit_80036pt7b); }
+
+static void benchGetTextBounds(BenchDisplay *display, uint32_t iteration) {
+  int16_t x, y;
+  uint16_t w, h;
+  display->setFont(&Outfit_80036pt7b);
+  display->getTextBounds("12:34", 0, 125, &x, &y, &w, &h);
+}
+
+template <class R> static void benchGetTextBoundsStatic(R *renderer) {
+  int16_t x, y;
+  uint16_t w, h;
+  renderer->setFont(&Outfit_80036pt7b);
+  renderer->getTextBounds("12:34", 0, 125, &x, &y, &w, &h);
+}
+
+static void benchPrintString(BenchDisplay *display, uint32_t iteration) {
+  display->setFont(&Outfit_60011pt7b);
+  printString(display, "Mon, June 3", 100, 60, TextAlign::CENTER, TEXT_EXTENT(Outfit_60011pt7bMetrics, "Mon, June 3"));
+}
+
+template <class R> static void benchPrintStringStatic(R *renderer) {
+  renderer->setFont(&Outfit_60011pt7b);
+  renderer->setCursor(100 - textWidth(TEXT_EXTENT(Outfit_60011pt7bMetrics, "Mon, June 3")) / 2, 60);
+  renderer->print("Mon, June 3");
+}
+
+static const Benchmark benchmarks[] = {
+    {"home background", 200, benchHomeBackground},
+    {"home widgets", 200, benchHomeWidgets},
+    {"home widgets (clipped)", 200, benchHomeWidgetsClipped},
+    {"home minute (list)", 200, benchHomeMinute},
+    {"apps list", 200, benchAppsList},
+    {"app about", 200, benchAbout},
+    {"fillRect", 2000, benchFillRect},
+    STATIC_BENCHMARK("fillRect (static)", 2000, benchFillRectStatic),
+    {"drawLine", 2000, benchDrawLine},
+    {"drawRoundRect", 2000, benchDrawRoundRect},
+    STATIC_BENCHMARK("drawRoundRect (static)", 2000, benchDrawRoundRectStatic),
+    {"fillRoundRect", 2000, benchFillRoundRect},
+    STATIC_BENCHMARK("fillRoundRect (static)", 2000, benchFillRoundRectStatic),
+    {"fillCircle", 2000, benchFillCircle},
+    STATIC_BENCHMARK("fillCircle (static)", 2000, benchFillCircleStatic),
+    {"fillTriangle", 2000, benchFillTriangle},
+    {"drawBitmap", 2000, benchDrawBitmap},
+    {"drawBitmap (per pixel)", 2000, benchDrawBitmapPerPixel},
+    STATIC_BENCHMARK("drawBitmap (static)", 2000, benchDrawBitmapStatic),
+    {"drawAsset (RLE)", 2000, benchDrawAssetRle},
+    STATIC_BENCHMARK("drawAsset (RLE, static)", 2000, benchDrawAssetRleStatic),
+    {"drawChar", 2000, benchDrawChar},
+    STATIC_BENCHMARK("drawChar (static)", 2000, benchDrawCharStatic),
+    {"clock (raw font)", 2000, benchClockRaw},
+    {"clock (RLE font)", 2000, benchClockRle},
+    {"getTextBounds", 2000, benchGetTextBounds},
+    STATIC_BENCHMARK("getTextBounds (static)", 2000, benchGetTextBoundsStatic),
+    {"printString", 2000, benchPrintString},
+    STATIC_BENCHMARK("printString (static)", 2000, benchPrintStringStatic),
+};
+
+static void runAll(const char *filter) {
+  rtc.setTime(0, 34, 12, 3, 6, 2024);
+  display.setRotation(1);
+  display.setTextColor(GxEPD_BLACK);
+  display.setTextWrap(false);
+
+  static BenchRenderer frameRenderer(display.getBuffer());
+  static CountingRenderer countingRenderer(display.getBuffer(), &display.pixels);
+  renderer = &frameRenderer;
+  counter = &countingRenderer;
+
+  initApps();
+  for (auto &app : apps)
+    if (app->name == "About")
+      appAboutInstance = app.get();
+
+  display.fillScreen(GxEPD_WHITE);
+  drawHomeBackground(&display);
+  display.endLayer(&homeLayer, homeBackgroundKey());
+
+  runBenchmarks(&display, benchmarks, sizeof(benchmarks) / sizeof(benchmarks[0]), filter);
+  Serial.printf("\nclock font bitmaps: %u bytes raw, %u bytes RLE\n", (unsigned)sizeof(Outfit_80036pt7bRawBitmaps),
+                (unsigned)sizeof(Outfit_80036pt7bBitmaps));
+}
+
+#ifdef ESP32
+void setup() {
+  Serial.begin(115200);
+  delay(1000);
+  runAll("");
+}
+
+void loop() { delay(1000); }
+#else
+// An optional argument only runs the benchmarks whose name contains it
+int main(int argc, char **argv) {
+  runAll(argc > 1 ? argv[1] : "");
+  return 0;
+}
+#endif
@@ -4,8 +4,45 @@ const char *months[] = {"January", "February", "March", "April", "May", "June",
 
 const char *days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 
+static const char *prayerStr = "Isha, 22:10";
+static const char *stepsStr = "7.546";
+static const char *weatherStr = "24°C";
+
+void drawHomeBackground(GxEPD_Class *display) {
+  display->setTextColor(GxEPD_BLACK);
+  display->setTextWrap(false);
+  display->setFont(&Outfit_60011pt7b);
+
+  // Status icons
+  drawAsset(display, 2, 2, icon_wifi_small, GxEPD_BLACK);
+  drawAsset(display, 30, 2, icon_no_ble_small, GxEPD_BLACK);
+  drawAsset(display, 58, 2, icon_gps_small, GxEPD_BLACK);
+
+  // Prayer time
+  drawAsset(display, 2, 142, icon_prayer_small, GxEPD_BLACK);
+  printLeftString(display, prayerStr, 34, 164);
+
+  // Steps
+  drawAsset(display, 2, 170, icon_steps_small, GxEPD_BLACK);
+  printLeftString(display, stepsStr, 34, 192);
+
+  // Weather
+  drawAsset(display, 170, 170, icon_weather_small, GxEPD_BLACK);
+  printString(display, weatherStr, 166, 192, TextAlign::RIGHT, TEXT_EXTENT(Outfit_60011pt7bMetrics, "24°C"));
+}
+
+uint32_t homeBackgroundKey() {
+  // FNV-1a over everything the background shows
+  uint32_t hash = 2166136261u;
+  for (const char *str : {prayerStr, stepsStr, weatherStr}) {
+    for (const char *c = str; *c; c++)
+      hash = (hash ^ (uint8_t)*c) * 16777619u;
+    hash = (hash ^ 0) * 16777619u;
+  }
+  return hash;
+}
+
 void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus) {
-  display->fillScreen(GxEPD_WHITE);
   display->setTextColor(GxEPD_BLACK);
   display->setTextWrap(false);
 
@@ -18,31 +55,14 @@ void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus) {
 
   // Date
   display->setFont(&Outfit_60011pt7b);
-  printCenterString(display, String(String(days[rtc->getDayofWeek()]) + ", " + String(months[rtc->getMonth()]) + " " + String(rtc->getDay())).c_str(),
-                    100, 60);
+  String dateStr = String(days[rtc->getDayofWeek()]) + ", " + String(months[rtc->getMonth()]) + " " + String(rtc->getDay());
+  printCenterString(display, dateStr.c_str(), 100, 60);
 
   // Battery
-  printRightString(display, String(String(batteryStatus) + "%").c_str(), 166, 22);
-
-  const unsigned char *icon_battery_small_array[6] = {epd_bitmap_icon_battery_0_small,  epd_bitmap_icon_battery_20_small,
-                                                      epd_bitmap_icon_battery_40_small, epd_bitmap_icon_battery_60_small,
-                                                      epd_bitmap_icon_battery_80_small, epd_bitmap_icon_battery_100_small};
-  display->drawBitmap(170, 2, icon_battery_small_array[batteryStatus / 20], 28, 28, GxEPD_BLACK);
-
-  // Status icons
-  display->drawBitmap(2, 2, icon_wifi_small, 28, 28, GxEPD_BLACK);
-  display->drawBitmap(30, 2, icon_no_ble_small, 28, 28, GxEPD_BLACK);
-  display->drawBitmap(58, 2, icon_gps_small, 28, 28, GxEPD_BLACK);
+  String batteryStr = String(batteryStatus) + "%";
+  printRightString(display, batteryStr.c_str(), 166, 22);
 
-  // Prayer time
-  display->drawBitmap(2, 142, icon_prayer_small, 28, 28, GxEPD_BLACK);
-  printLeftString(display, "Isha, 22:10", 34, 164);
-
-  // Steps
-  display->drawBitmap(2, 170, icon_steps_small, 28, 28, GxEPD_BLACK);
-  printLeftString(display, "7.546", 34, 192);
-
-  // Weather
-  display->drawBitmap(170, 170, icon_weather_small, 28, 28, GxEPD_BLACK);
-  printRightString(display, "24°C", 166, 192);
-}
\ No newline at end of file
+  const Asset *icon_battery_small_array[6] = {&icon_battery_0_small,  &icon_battery_20_small, &icon_battery_40_small,
+                                              &icon_battery_60_small, &icon_battery_80_small, &icon_battery_100_small};
+  drawAsset(display, 170, 2, *icon_battery_small_array[batteryStatus / 20], GxEPD_BLACK);
+}
@@ -11,4 +11,9 @@
 #include "resources/fonts/Outfit_80036pt7b.h"
 #include "resources/icons.h"
 
-void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus);
\ No newline at end of file
+// The parts of the home screen that only change with their own data, drawn once into a background layer
+void drawHomeBackground(GxEPD_Class *display);
+// Changes whenever drawHomeBackground() would draw something else
+uint32_t homeBackgroundKey();
+// The widgets that change every minute, drawn over the background
+void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus);
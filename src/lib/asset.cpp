@@ -0,0 +1,101 @@
+#include "asset.h"
+
+#include "lib/region.h"
+
+// Calls span(x, y, n) for every run of set pixels in the stored image, splitting runs where they wrap a row
+template <typename Span> static void forEachRun(const Asset &asset, int16_t width, int16_t height, Span span) {
+  if (asset.encoding == AssetEncoding::RLE) {
+    const uint8_t *data = asset.data;
+    bool on = false;
+    int16_t x = 0, y = 0;
+    while (width && y < height) {
+      uint16_t len = 0;
+      uint8_t value;
+      do {
+        value = pgm_read_byte(data++);
+        len += value;
+      } while (value == 255);
+
+      while (len) {
+        int16_t n = min((int16_t)len, (int16_t)(width - x));
+        if (on)
+          span(x, y, n);
+        len -= n;
+        if ((x += n) == width) {
+          x = 0;
+          y++;
+        }
+      }
+      on = !on;
+    }
+    return;
+  }
+
+  int16_t stride = (width + 7) / 8;
+  for (int16_t y = 0; y < height; y++) {
+    const uint8_t *row = asset.data + y * stride;
+    int16_t run = -1;
+    for (int16_t x = 0; x <= width; x++) {
+      bool on = x < width && (pgm_read_byte(&row[x >> 3]) & (0x80 >> (x & 7)));
+      if (on) {
+        if (run < 0)
+          run = x;
+      } else if (run >= 0) {
+        span(run, y, x - run);
+        run = -1;
+      }
+    }
+  }
+}
+
+void drawAsset(GxEPD_Class *display, int16_t x, int16_t y, const Asset &asset, uint16_t color) {
+  if (!asset.native) {
+    if (asset.encoding == AssetEncoding::RAW) {
+      display->drawBitmap(x, y, asset.data, asset.width, asset.height, color);
+      return;
+    }
+    forEachRun(asset, asset.width, asset.height, [&](int16_t sx, int16_t sy, int16_t n) { display->drawFastHLine(x + sx, y + sy, n, color); });
+    return;
+  }
+
+  // A quarter turn swaps the stored dimensions
+  int16_t storedWidth = (asset.rotation & 1) ? asset.height : asset.width;
+  int16_t storedHeight = (asset.rotation & 1) ? asset.width : asset.height;
+
+  uint8_t rotation = display->getRotation();
+  if (asset.rotation == rotation) {
+    // Stored rows are panel rows, draw them unrotated
+    display->setRotation(0);
+    Rect native = rotateRect({x, y, (int16_t)asset.width, (int16_t)asset.height}, rotation, display->width(), display->height());
+    if (asset.encoding == AssetEncoding::RAW) {
+      display->drawBitmap(native.x, native.y, asset.data, storedWidth, storedHeight, color);
+    } else {
+      forEachRun(asset, storedWidth, storedHeight,
+                 [&](int16_t sx, int16_t sy, int16_t n) { display->drawFastHLine(native.x + sx, native.y + sy, n, color); });
+    }
+    display->setRotation(rotation);
+    return;
+  }
+
+  // Pre-rotated for another orientation, undo the rotation pixel by pixel
+  forEachRun(asset, storedWidth, storedHeight, [&](int16_t sx, int16_t sy, int16_t n) {
+    for (; n > 0; n--, sx++) {
+      int16_t i = sx, j = sy;
+      switch (asset.rotation) {
+      case 1:
+        i = sy;
+        j = asset.height - 1 - sx;
+        break;
+      case 2:
+        i = asset.width - 1 - sx;
+        j = asset.height - 1 - sy;
+        break;
+      case 3:
+        i = asset.width - 1 - sy;
+        j = sx;
+        break;
+      }
+      display->drawPixel(x + i, y + j, color);
+    }
+  });
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Arduino.h"
+#include "GxDEPG0150BN/GxDEPG0150BN.h" // 1.54" b/w 200x200
+#include "GxEPD.h"
+
+enum class AssetEncoding : uint8_t { RAW, RLE };
+
+// A 1-bpp image generated by tools/assetconvert.py. RAW data is the drawBitmap() layout (rows padded to whole bytes),
+// RLE data is one stream of GFXFONT_RLE runs over all pixels in row order. A `native` asset was pre-rotated for
+// `rotation`, so its rows are panel rows and it is drawn with the display at rotation 0.
+struct Asset {
+  const uint8_t *data;
+  uint16_t width; // As it appears on screen, before any pre-rotation
+  uint16_t height;
+  AssetEncoding encoding;
+  bool native;
+  uint8_t rotation;
+};
+
+// Draws the set pixels of the asset with its top left corner at (x, y), leaving the others untouched like drawBitmap()
+void drawAsset(GxEPD_Class *display, int16_t x, int16_t y, const Asset &asset, uint16_t color);
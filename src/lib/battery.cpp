@@ -1,6 +1,9 @@
 #include "battery.h"
 
+#include "lib/boot.h"
+
 int calculateBatteryStatus() {
+  bootRequire(Subsystem::ADC);
   int bat = 0;
   for (uint8_t i = 0; i < 25; i++) {
     bat += analogRead(BAT_ADC);
@@ -0,0 +1,72 @@
+#include "boot.h"
+
+#include "lib/log.h"
+
+static const SubsystemSetup *setups = nullptr;
+static uint16_t started = 0;
+static bool done = false;
+static uint32_t startUs[(uint8_t)Subsystem::COUNT];
+
+void bootBegin(const SubsystemSetup *subsystemSetups) {
+  setups = subsystemSetups;
+  started = 0;
+  done = false;
+}
+
+void bootProfile(const BootProfile &profile) {
+  for (uint8_t i = 0; i < (uint8_t)Subsystem::COUNT; i++)
+    if (profile.subsystems & (1u << i))
+      bootRequire((Subsystem)i);
+}
+
+void bootRequire(Subsystem subsystem) {
+  uint8_t i = (uint8_t)subsystem;
+  if (setups == nullptr || (started & (1u << i)))
+    return;
+  // Marked first, so that a subsystem that needs itself cannot recurse
+  started |= 1u << i;
+
+  for (uint8_t j = 0; j < (uint8_t)Subsystem::COUNT; j++)
+    if (setups[i].needs & (1u << j))
+      bootRequire((Subsystem)j);
+
+  uint32_t begin = micros();
+  if (setups[i].start != nullptr)
+    setups[i].start();
+  startUs[i] = micros() - begin;
+  if (done)
+    log(LogLevel::INFO, (String("Started ") + setups[i].name + " on first use in " + String(startUs[i]) + " us").c_str());
+}
+
+bool bootStarted(Subsystem subsystem) { return started & (1u << (uint8_t)subsystem); }
+
+void bootDone(const BootProfile &profile, BootTimes *times) {
+  uint32_t now = micros();
+  if (times->count == 0 || now < times->minUs)
+    times->minUs = now;
+  if (now > times->maxUs)
+    times->maxUs = now;
+  times->lastUs = now;
+  times->totalUs += now;
+  times->count++;
+
+  done = true;
+  if (setups == nullptr)
+    return;
+  String line = String("Boot profile ") + profile.name + " ready after " + String(now) + " us:";
+  for (uint8_t i = 0; i < (uint8_t)Subsystem::COUNT; i++)
+    if (started & (1u << i))
+      line += String(" ") + setups[i].name + " " + String(startUs[i]) + " us";
+  log(LogLevel::INFO, line.c_str());
+}
+
+void bootReport(const BootProfile profiles[], const BootTimes times[], uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (times[i].count == 0)
+      continue;
+    String line = String("Boot profile ") + profiles[i].name + ": " + String(times[i].count) + " wakes, last " + String(times[i].lastUs) +
+                  " us, min " + String(times[i].minUs) + " us, avg " + String((uint32_t)(times[i].totalUs / times[i].count)) + " us, max " +
+                  String(times[i].maxUs) + " us";
+    log(LogLevel::INFO, line.c_str());
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Arduino.h"
+
+// What setup() can bring up. A wake starts the subsystems its BootProfile lists before its handler runs, any other is
+// started by bootRequire() the first time something needs it, so each wake only pays for what it uses.
+enum class Subsystem : uint8_t { SERIAL_LOG, SPI_BUS, PANEL, ADC, CLOCK, BUTTON, UI_TIMER, WIFI, PREFERENCES, COUNT };
+
+#define SUBSYSTEM_BIT(s) (1u << (uint8_t)Subsystem::s)
+
+// How to start one subsystem, and the subsystems (SUBSYSTEM_BIT()s) that have to be started before it
+struct SubsystemSetup {
+  const char *name;
+  void (*start)();
+  uint16_t needs;
+};
+
+// The subsystems a wake type starts up front
+struct BootProfile {
+  const char *name;
+  uint16_t subsystems;
+};
+
+// Time from the start of the app (micros(), after the bootloader) until the wake handler ran, for every wake of one
+// profile, kept across deep sleep
+struct BootTimes {
+  uint32_t count;
+  uint32_t lastUs;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+};
+
+// `setups` holds one entry per Subsystem in enum order and has to outlive the wake
+void bootBegin(const SubsystemSetup *setups);
+// Starts every subsystem of `profile`, in enum order
+void bootProfile(const BootProfile &profile);
+// Starts `subsystem` and what it needs, unless it already is. Does nothing before bootBegin(), e.g. on the host.
+void bootRequire(Subsystem subsystem);
+bool bootStarted(Subsystem subsystem);
+// Adds the time since the app started to `times` and logs what this wake started and how long each took
+void bootDone(const BootProfile &profile, BootTimes *times);
+// Logs the boot times of every profile
+void bootReport(const BootProfile profiles[], const BootTimes times[], uint8_t count);
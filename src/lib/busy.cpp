@@ -0,0 +1,57 @@
+#include "busy.h"
+
+BusyWait::BusyWait(uint32_t timeoutUs) : timeoutUs(timeoutUs) {}
+
+void BusyWait::start(uint32_t nowUs) {
+  current = BusyState::STARTED;
+  busyStart = nowUs;
+  busyTotal = 0;
+}
+
+BusyAction BusyWait::poll(bool busy, uint32_t nowUs) {
+  switch (current) {
+  case BusyState::STARTED:
+  case BusyState::DONE:
+    // BUSY not raised yet for this phase, sleeping now would wake straight away
+    if (!busy)
+      return BusyAction::WAIT;
+    current = BusyState::BUSY;
+    busyStart = nowUs;
+    return BusyAction::SLEEP;
+
+  case BusyState::BUSY:
+    if (!busy) {
+      current = BusyState::DONE;
+      busyTotal += nowUs - busyStart;
+      return BusyAction::WAIT;
+    }
+    // Stuck asserted, leave it to the driver's own timeout
+    if (nowUs - busyStart >= timeoutUs) {
+      current = BusyState::TIMEOUT;
+      busyTotal += nowUs - busyStart;
+      return BusyAction::WAIT;
+    }
+    return BusyAction::SLEEP;
+
+  default:
+    return BusyAction::WAIT;
+  }
+}
+
+void BusyWait::stop(uint32_t nowUs) {
+  // The driver saw BUSY drop before the next poll did
+  if (current == BusyState::BUSY)
+    busyTotal += nowUs - busyStart;
+  current = BusyState::IDLE;
+}
+
+BusyState BusyWait::state() const { return current; }
+
+uint32_t BusyWait::sleepUs(uint32_t nowUs) const {
+  if (current != BusyState::BUSY)
+    return 0;
+  uint32_t elapsed = nowUs - busyStart;
+  return elapsed < timeoutUs ? timeoutUs - elapsed : 0;
+}
+
+uint32_t BusyWait::busyUs() const { return busyTotal; }
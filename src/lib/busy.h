@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+enum class BusyState : uint8_t { IDLE, STARTED, BUSY, DONE, TIMEOUT };
+enum class BusyAction : uint8_t { WAIT, SLEEP };
+
+// Tracks the panel's BUSY line through a refresh and decides when the SoC may sleep until it drops. It only sees the
+// pin level and the time, so the sequence can be replayed against a mocked pin. BUSY may rise and fall several
+// times per refresh, since the driver waits on it after every command phase.
+class BusyWait {
+public:
+  explicit BusyWait(uint32_t timeoutUs);
+
+  // A refresh is about to be sent to the panel
+  void start(uint32_t nowUs);
+  // Called with the BUSY level whenever the CPU is about to idle. SLEEP means sleep for at most sleepUs(), waking
+  // early when BUSY goes idle. Nothing is slept until BUSY has been seen asserted, or after it stayed asserted too long.
+  BusyAction poll(bool busy, uint32_t nowUs);
+  // The refresh call returned
+  void stop(uint32_t nowUs);
+
+  BusyState state() const;
+  uint32_t sleepUs(uint32_t nowUs) const;
+  // Time BUSY was seen asserted during the last refresh, 0 if it never was
+  uint32_t busyUs() const;
+
+private:
+  uint32_t timeoutUs;
+  BusyState current = BusyState::IDLE;
+  uint32_t busyStart = 0;
+  uint32_t busyTotal = 0;
+};
@@ -0,0 +1,455 @@
+#include "display.h"
+
+#include "driver/gpio.h"
+#include "esp_freertos_hooks.h"
+#include "esp_sleep.h"
+
+#include "lib/energy.h"
+#include "lib/log.h"
+
+// Give up sleeping on BUSY after this long, the driver has its own timeout to report a stuck panel
+#define BUSY_SLEEP_TIMEOUT_US 5000000
+
+// The display waiting on BUSY from inside a refresh call, for the idle hook
+static FrameDisplay *volatile refreshingDisplay = nullptr;
+
+FrameDisplay::FrameDisplay(GxIO &io, int8_t rst, int8_t busy, uint8_t *panelFrame)
+    : GxEPD_Class(io, rst, busy), frame(GxEPD_WIDTH, GxEPD_HEIGHT), panelFrame(panelFrame), busyWait(BUSY_SLEEP_TIMEOUT_US) {}
+
+void FrameDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!capture({DrawPrimType::PIXEL, rotation, color, 0, x, y, 1, 1, nullptr}))
+    frame.drawPixel(x, y, color);
+}
+
+void FrameDisplay::fillScreen(uint16_t color) {
+  // Covers everything drawn so far, the list starts over on the new background
+  if (listMode == ListMode::RECORDING) {
+    list.clear(color);
+    return;
+  }
+  if (listMode == ListMode::OFF)
+    forgetList();
+  frame.fillScreen(color);
+}
+
+void FrameDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!capture({DrawPrimType::FILL_RECT, rotation, color, 0, x, y, w, h, nullptr}))
+    frame.fillRect(x, y, w, h, color);
+}
+
+void FrameDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (!capture({DrawPrimType::VLINE, rotation, color, 0, x, y, 1, h, nullptr}))
+    frame.drawFastVLine(x, y, h, color);
+}
+
+void FrameDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (!capture({DrawPrimType::HLINE, rotation, color, 0, x, y, w, 1, nullptr}))
+    frame.drawFastHLine(x, y, w, color);
+}
+
+void FrameDisplay::writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) {
+  if (listMode != ListMode::RECORDING) {
+    if (listMode == ListMode::OFF)
+      forgetList();
+    frame.writeSpanMask(x, y, w, mask, color);
+    return;
+  }
+
+  for (int16_t i = 0; i < w && mask; i++, mask <<= 1) {
+    if (!(mask & 0x80000000UL))
+      continue;
+    int16_t n = 1;
+    while (i + n < w && ((mask << n) & 0x80000000UL))
+      n++;
+    drawFastHLine(x + i, y, n, color);
+    i += n - 1;
+    mask <<= n - 1;
+  }
+}
+
+void FrameDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+  if (!capture({DrawPrimType::BITMAP, rotation, color, 0, x, y, w, h, bitmap}))
+    frame.drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void FrameDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  if (!capture({DrawPrimType::BITMAP_BG, rotation, color, bg, x, y, w, h, bitmap}))
+    frame.drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+void FrameDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  if (!capture({DrawPrimType::BITMAP, rotation, color, 0, x, y, w, h, bitmap}, true))
+    frame.drawBitmap(x, y, bitmap, w, h, color);
+}
+
+void FrameDisplay::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  if (!capture({DrawPrimType::BITMAP_BG, rotation, color, bg, x, y, w, h, bitmap}, true))
+    frame.drawBitmap(x, y, bitmap, w, h, color, bg);
+}
+
+void FrameDisplay::setRotation(uint8_t r) {
+  GxEPD_Class::setRotation(r);
+  frame.setRotation(r);
+  // Keeps what is drawn around a rotation switch, like a pre-rotated asset, in an op of its own
+  if (listMode == ListMode::RECORDING)
+    list.split();
+}
+
+#ifdef GFX_PROFILE
+void FrameDisplay::setProfiler(GFXprofiler *p) {
+  GxEPD_Class::setProfiler(p);
+  frame.setProfiler(p);
+}
+#endif
+
+bool FrameDisplay::pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!GxEPD_Class::pushClipRect(x, y, w, h))
+    return false;
+  frame.pushClipRect(x, y, w, h);
+  return true;
+}
+
+void FrameDisplay::popClipRect() {
+  GxEPD_Class::popClipRect();
+  frame.popClipRect();
+}
+
+size_t FrameDisplay::write(uint8_t c) {
+  if (listMode != ListMode::RECORDING) {
+    if (listMode == ListMode::OFF)
+      forgetList();
+    return GxEPD_Class::write(c);
+  }
+
+  DrawOp style = {};
+  style.type = DrawOpType::TEXT;
+  style.rotation = rotation;
+  style.font = gfxFont;
+  style.color = textcolor;
+  style.bg = textbgcolor;
+  style.sizeX = textsize_x;
+  style.sizeY = textsize_y;
+  style.wrap = wrap;
+  style.x = cursor_x;
+  style.y = cursor_y;
+
+  // Measure the glyph and advance the cursor the way write() would, without drawing. write() never wraps
+  // before a glyph without pixels, charBounds() does.
+  if (gfxFont && c >= pgm_read_byte(&gfxFont->first) && c <= pgm_read_byte(&gfxFont->last)) {
+    const GFXglyph *glyph = &gfxFont->glyph[c - pgm_read_byte(&gfxFont->first)];
+    if (pgm_read_byte(&glyph->width) == 0 || pgm_read_byte(&glyph->height) == 0)
+      wrap = false;
+  }
+  int16_t minX = INT16_MAX, minY = INT16_MAX, maxX = INT16_MIN, maxY = INT16_MIN;
+  charBounds(c, &cursor_x, &cursor_y, &minX, &minY, &maxX, &maxY);
+  wrap = style.wrap;
+  style.endX = cursor_x;
+  style.endY = cursor_y;
+
+  Rect bounds = {0, 0, 0, 0};
+  if (maxX >= minX && maxY >= minY) {
+    bounds = rotateRect({minX, minY, (int16_t)(maxX - minX + 1), (int16_t)(maxY - minY + 1)}, rotation, GxEPD_WIDTH, GxEPD_HEIGHT);
+    bounds = rectIntersection(bounds, {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT});
+  }
+  if (list.addChar(c, style, bounds))
+    return 1;
+
+  // The list is full, draw this one right away
+  cursor_x = style.x;
+  cursor_y = style.y;
+  flushList();
+  return GxEPD_Class::write(c);
+}
+
+void FrameDisplay::update() {
+  Rect window = {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT};
+  pushToDriver(window);
+  beginRefresh();
+  GxEPD_Class::update();
+  endRefresh();
+  retainWindow(window);
+}
+
+void FrameDisplay::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation) {
+  Rect window = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+  window = panelWindow(window, using_rotation ? getRotation() : 0, GxEPD_WIDTH, GxEPD_HEIGHT);
+
+  // Shrink the window to the pixels that actually changed, nothing to do if none did
+  FrameDiff changed = diff(window);
+  if (changed.pixels == 0)
+    return;
+
+  uint32_t start = micros();
+  pushToDriver(changed.bounds);
+  beginRefresh();
+  GxEPD_Class::updateWindow(changed.bounds.x, changed.bounds.y, changed.bounds.w, changed.bounds.h, false);
+  endRefresh();
+  if (calibration != nullptr)
+    addRefreshSample(calibration, windowBytes(changed.bounds), micros() - start, busyWait.busyUs());
+  retainWindow(changed.bounds);
+}
+
+FrameDiff FrameDisplay::diff(const Rect &window) const { return frameDiff(panelFrame, frame.getBuffer(), GxEPD_WIDTH, GxEPD_HEIGHT, window); }
+
+void FrameDisplay::plan(const DirtyRegions &dirty, const RefreshCost &cost, RefreshPlan *plan) const {
+  planRefresh(panelFrame, frame.getBuffer(), GxEPD_WIDTH, GxEPD_HEIGHT, dirty, cost, plan);
+}
+
+void FrameDisplay::setCalibration(RefreshCalibration *calibration) { this->calibration = calibration; }
+
+void FrameDisplay::sleepWhileBusy(int8_t busyPin) {
+  if (busyPin >= 0 && this->busyPin < 0)
+    esp_register_freertos_idle_hook_for_cpu(sleepHook, xPortGetCoreID());
+  else if (busyPin < 0 && this->busyPin >= 0)
+    esp_deregister_freertos_idle_hook_for_cpu(sleepHook, xPortGetCoreID());
+  this->busyPin = busyPin;
+}
+
+uint8_t *FrameDisplay::getBuffer() const { return frame.getBuffer(); }
+
+void FrameDisplay::beginList(DisplayListState *state, bool overLayer) {
+  if (!frameTouched) {
+    // After a deep sleep the frame starts out blank, bring back what the panel shows
+    if (state->valid)
+      memcpy(frame.getBuffer(), panelFrame, FRAME_BUFFER_SIZE);
+  } else if (listState != state) {
+    // The frame shows something else, both lists have to start over
+    if (listState != nullptr)
+      listState->valid = false;
+    state->valid = false;
+  }
+
+  frameTouched = true;
+  listState = state;
+  listOverflowed = false;
+  list.clear(GxEPD_WHITE);
+  list.setLayer(overLayer ? layerKey : 0);
+  listMode = ListMode::RECORDING;
+}
+
+void FrameDisplay::endList(DirtyRegions *dirty) {
+  Rect panel = {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT};
+  if (listOverflowed) {
+    listOverflowed = false;
+    dirty->add(panel);
+    return;
+  }
+  if (listMode != ListMode::RECORDING)
+    return;
+
+  bool replayOps[DISPLAY_LIST_MAX_OPS];
+  DirtyRegions invalid;
+  list.invalidate(*listState, panel, &invalid, replayOps);
+
+  listMode = ListMode::REPLAYING;
+  uint8_t savedRotation = rotation;
+  for (uint8_t i = 0; i < invalid.size(); i++) {
+    fillBackground(invalid[i]);
+    dirty->add(invalid[i]);
+
+    // Only what lies inside the rect changes, an op that spans several rects is replayed once for each
+    setRotation(0);
+    bool clipped = pushClipRect(invalid[i].x, invalid[i].y, invalid[i].w, invalid[i].h);
+    setRotation(savedRotation);
+    for (uint8_t j = 0; j < list.size(); j++) {
+      if (replayOps[j] && rectIntersects(list[j].bounds, invalid[i]))
+        replay(list[j]);
+    }
+    if (clipped)
+      popClipRect();
+  }
+  listMode = ListMode::OFF;
+
+  list.save(listState);
+}
+
+bool FrameDisplay::restoreLayer(const LayerState *state, uint32_t key) {
+  if (!::restoreLayer(*state, key, layer, FRAME_BUFFER_SIZE))
+    return false;
+  layerKey = key ? key : 1;
+  return true;
+}
+
+void FrameDisplay::endLayer(LayerState *state, uint32_t key) {
+  memcpy(layer, frame.getBuffer(), FRAME_BUFFER_SIZE);
+  layerKey = key ? key : 1;
+  if (!retainLayer(state, key, layer, FRAME_BUFFER_SIZE))
+    log(LogLevel::WARNING, "Background layer too detailed to retain, redrawing it every wake");
+}
+
+bool FrameDisplay::capture(const DrawPrim &prim, bool hashBitmap) {
+  if (listMode == ListMode::REPLAYING)
+    return false;
+  if (listMode == ListMode::OFF) {
+    forgetList();
+    return false;
+  }
+
+  // Lines may be given with a negative length
+  Rect bounds = {prim.x, prim.y, prim.w, prim.h};
+  if (bounds.w < 0) {
+    bounds.x += bounds.w + 1;
+    bounds.w = -bounds.w;
+  }
+  if (bounds.h < 0) {
+    bounds.y += bounds.h + 1;
+    bounds.h = -bounds.h;
+  }
+  bounds = rectIntersection(rotateRect(bounds, prim.rotation, GxEPD_WIDTH, GxEPD_HEIGHT), {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT});
+  if (list.addPrim(prim, bounds, hashBitmap))
+    return true;
+
+  flushList();
+  return false;
+}
+
+void FrameDisplay::forgetList() {
+  // Drawing outside of a list, the frame no longer shows what the last list recorded
+  if (listState != nullptr)
+    listState->valid = false;
+  listState = nullptr;
+  frameTouched = true;
+}
+
+void FrameDisplay::flushList() {
+  // Out of room: draw the whole list now and the rest of the frame immediately, endList() then reports the full panel
+  listMode = ListMode::REPLAYING;
+  fillBackground({0, 0, GxEPD_WIDTH, GxEPD_HEIGHT});
+  for (uint8_t i = 0; i < list.size(); i++)
+    replay(list[i]);
+  listMode = ListMode::OFF;
+  listOverflowed = true;
+  log(LogLevel::WARNING, "Display list full, drawing immediately");
+  forgetList();
+}
+
+void FrameDisplay::fillBackground(const Rect &rect) {
+  if (list.layer() != 0) {
+    copyLayerRect(layer, frame.getBuffer(), GxEPD_WIDTH, GxEPD_HEIGHT, rect);
+    return;
+  }
+  frame.setRotation(0);
+  frame.fillRect(rect.x, rect.y, rect.w, rect.h, list.background());
+  frame.setRotation(rotation);
+}
+
+void FrameDisplay::replay(const DrawOp &op) {
+  if (op.type == DrawOpType::TEXT) {
+    // Print again through write(), under the rotation and text state the characters were recorded with
+    uint8_t savedRotation = rotation;
+    GFXfont *savedFont = gfxFont;
+    uint16_t savedColor = textcolor, savedBg = textbgcolor;
+    uint8_t savedSizeX = textsize_x, savedSizeY = textsize_y;
+    bool savedWrap = wrap;
+    int16_t savedX = cursor_x, savedY = cursor_y;
+
+    setRotation(op.rotation);
+    gfxFont = (GFXfont *)op.font;
+    textcolor = op.color;
+    textbgcolor = op.bg;
+    textsize_x = op.sizeX;
+    textsize_y = op.sizeY;
+    wrap = op.wrap;
+    cursor_x = op.x;
+    cursor_y = op.y;
+    for (uint16_t i = 0; i < op.count; i++)
+      GxEPD_Class::write(list.text(op.first + i));
+
+    setRotation(savedRotation);
+    gfxFont = savedFont;
+    textcolor = savedColor;
+    textbgcolor = savedBg;
+    textsize_x = savedSizeX;
+    textsize_y = savedSizeY;
+    wrap = savedWrap;
+    cursor_x = savedX;
+    cursor_y = savedY;
+    return;
+  }
+
+  for (uint16_t i = 0; i < op.count; i++) {
+    const DrawPrim &prim = list.prim(op.first + i);
+    frame.setRotation(prim.rotation);
+    switch (prim.type) {
+    case DrawPrimType::PIXEL:
+      frame.drawPixel(prim.x, prim.y, prim.color);
+      break;
+    case DrawPrimType::HLINE:
+      frame.drawFastHLine(prim.x, prim.y, prim.w, prim.color);
+      break;
+    case DrawPrimType::VLINE:
+      frame.drawFastVLine(prim.x, prim.y, prim.h, prim.color);
+      break;
+    case DrawPrimType::FILL_RECT:
+      frame.fillRect(prim.x, prim.y, prim.w, prim.h, prim.color);
+      break;
+    case DrawPrimType::BITMAP:
+      frame.drawBitmap(prim.x, prim.y, prim.bitmap, prim.w, prim.h, prim.color);
+      break;
+    case DrawPrimType::BITMAP_BG:
+      frame.drawBitmap(prim.x, prim.y, prim.bitmap, prim.w, prim.h, prim.color, prim.bg);
+      break;
+    }
+  }
+  frame.setRotation(rotation);
+}
+
+bool FrameDisplay::sleepHook() {
+  // The driver polls BUSY with delay(), so the idle task runs for most of a refresh: sleep through it instead
+  FrameDisplay *display = refreshingDisplay;
+  if (display == nullptr || display->busyWait.poll(digitalRead(display->busyPin) == HIGH, micros()) != BusyAction::SLEEP)
+    return true;
+
+  gpio_wakeup_enable((gpio_num_t)display->busyPin, GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(display->busyWait.sleepUs(micros()));
+  // Only counted here, the idle task must not touch the energy accounting of the main task
+  uint32_t sleptAt = micros();
+  esp_light_sleep_start();
+  display->sleptUs += micros() - sleptAt;
+  gpio_wakeup_disable((gpio_num_t)display->busyPin);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  return true;
+}
+
+void FrameDisplay::beginRefresh() {
+  energyOn(EnergyLoad::PANEL);
+  sleptUs = 0;
+  busyWait.start(micros());
+  if (busyPin >= 0)
+    refreshingDisplay = this;
+}
+
+void FrameDisplay::endRefresh() {
+  refreshingDisplay = nullptr;
+  busyWait.stop(micros());
+  energySlept(sleptUs);
+  energyOff(EnergyLoad::PANEL);
+}
+
+void FrameDisplay::pushToDriver(const Rect &window) {
+  const uint8_t *buffer = frame.getBuffer();
+  uint16_t rowBytes = (GxEPD_WIDTH + 7) / 8;
+
+  // The driver applies its own rotation in drawPixel(), write in native coordinates
+  uint8_t rotation = getRotation();
+  GxEPD_Class::setRotation(0);
+  for (int16_t y = window.y; y < window.y + window.h; y++) {
+    for (int16_t x = window.x; x < window.x + window.w; x++) {
+      bool white = buffer[y * rowBytes + x / 8] & (0x80 >> (x & 7));
+      GxEPD_Class::drawPixel(x, y, white ? GxEPD_WHITE : GxEPD_BLACK);
+    }
+  }
+  GxEPD_Class::setRotation(rotation);
+}
+
+void FrameDisplay::retainWindow(const Rect &window) {
+  const uint8_t *buffer = frame.getBuffer();
+  uint16_t rowBytes = (GxEPD_WIDTH + 7) / 8;
+  uint16_t firstByte = window.x / 8;
+  uint16_t bytes = (window.x + window.w + 7) / 8 - firstByte;
+
+  for (int16_t y = window.y; y < window.y + window.h; y++)
+    memcpy(panelFrame + y * rowBytes + firstByte, buffer + y * rowBytes + firstByte, bytes);
+}
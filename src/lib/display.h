@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "GxDEPG0150BN/GxDEPG0150BN.h" // 1.54" b/w 200x200
+#include "GxEPD.h"
+#include "GxIO/GxIO.h"
+
+#include "lib/busy.h"
+#include "lib/displaylist.h"
+#include "lib/framediff.h"
+#include "lib/layer.h"
+#include "lib/refreshplan.h"
+#include "lib/region.h"
+
+#define FRAME_BUFFER_SIZE (GxEPD_WIDTH * GxEPD_HEIGHT / 8)
+
+// GxEPD display that renders into a frame buffer the firmware can read, since the driver's own
+// buffer is private. The frame is copied into the driver only for the windows that are pushed to
+// the panel, and `panelFrame` is kept equal to what the panel shows so that the next frame can be
+// diffed against it. Windows with no changed pixels are not refreshed at all.
+//
+// Between beginList() and endList() draw calls are recorded into a display list instead of drawn.
+// endList() compares the list against the one that last ended in the same DisplayListState, clears
+// the rects that changed to the background and replays the ops that overlap them clipped to those
+// rects, so a screen can be redrawn from scratch every frame while unchanged parts cost no more than
+// a hash compare.
+class FrameDisplay : public GxEPD_Class {
+public:
+  FrameDisplay(GxIO &io, int8_t rst, int8_t busy, uint8_t *panelFrame);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  // Bitmaps and glyphs drawn by Adafruit_GFX arrive here a row mask at a time, recorded as one HLINE per run of set bits
+  void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) override;
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) override;
+  using GxEPD_Class::drawBitmap;
+  void setRotation(uint8_t r) override;
+  // Clips apply to the frame as well, they are not recorded into display lists
+  bool pushClipRect(int16_t x, int16_t y, int16_t w, int16_t h) override;
+  void popClipRect() override;
+  size_t write(uint8_t c) override;
+  using GxEPD_Class::write;
+#ifdef GFX_PROFILE
+  // Draws end up in the frame canvas, so it reports to the profiler as well
+  void setProfiler(GFXprofiler *p) override;
+#endif
+
+  void update() override;
+  void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) override;
+
+  // Pixels that differ from the panel inside `window`, given in native panel coordinates
+  FrameDiff diff(const Rect &window) const;
+  // The cheapest windows to push for the changes inside `dirty` (native coordinates), see planRefresh()
+  void plan(const DirtyRegions &dirty, const RefreshCost &cost, RefreshPlan *plan) const;
+  // Times every updateWindow() into `calibration`, nullptr to stop
+  void setCalibration(RefreshCalibration *calibration);
+  // Light-sleeps the SoC, instead of idling at full clock, while the panel holds `busyPin` asserted during update() and
+  // updateWindow(). WiFi does not survive light sleep, so only turn this on with the radio off. -1 turns it off.
+  void sleepWhileBusy(int8_t busyPin);
+  uint8_t *getBuffer() const;
+
+  // Starts recording a frame that is diffed against `state`, which has to outlive the list. Bitmaps in RAM
+  // are read again when the list ends, so they must stay valid until then. With `overLayer` the rects that changed
+  // are cleared to the background layer instead of the fill color.
+  void beginList(DisplayListState *state, bool overLayer = false);
+  // Brings the frame up to date and adds the changed rects, in native panel coordinates, to `dirty`
+  void endList(DirtyRegions *dirty);
+
+  // The background layer is drawn like any frame and then taken from it with endLayer(). While the inputs it was
+  // drawn from, summed up in `key`, stay the same, restoreLayer() brings it back from `state` instead.
+  bool restoreLayer(const LayerState *state, uint32_t key);
+  void endLayer(LayerState *state, uint32_t key);
+
+private:
+  enum class ListMode : uint8_t { OFF, RECORDING, REPLAYING };
+
+  GFXcanvas1 frame;
+  uint8_t *panelFrame;
+  RefreshCalibration *calibration = nullptr;
+  BusyWait busyWait;
+  int8_t busyPin = -1;
+  volatile uint32_t sleptUs = 0; // Light sleep of the running refresh, added up by the idle hook
+
+  DisplayList list;
+  DisplayListState *listState = nullptr; // The list the frame currently shows, if any
+  ListMode listMode = ListMode::OFF;
+  bool listOverflowed = false;
+  bool frameTouched = false;
+
+  uint8_t layer[FRAME_BUFFER_SIZE];
+  uint32_t layerKey = 0; // Never 0 once there is a layer
+
+  bool capture(const DrawPrim &prim, bool hashBitmap = false);
+  void forgetList();
+  void flushList();
+  void fillBackground(const Rect &rect);
+  void replay(const DrawOp &op);
+
+  static bool sleepHook();
+  void beginRefresh();
+  void endRefresh();
+  void pushToDriver(const Rect &window);
+  void retainWindow(const Rect &window);
+};
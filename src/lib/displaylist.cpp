@@ -0,0 +1,182 @@
+#include "displaylist.h"
+
+// FNV-1a, folded over each field separately so struct padding never reaches the hash
+static uint32_t hashBytes(uint32_t hash, const void *data, size_t len) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+template <typename T> static uint32_t hashValue(uint32_t hash, const T &value) { return hashBytes(hash, &value, sizeof(value)); }
+
+static bool rectEquals(const Rect &a, const Rect &b) { return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h; }
+
+void DisplayList::clear(uint16_t background) {
+  opCount = 0;
+  primCount = 0;
+  charCount = 0;
+  fill = background;
+  open = false;
+}
+
+void DisplayList::setLayer(uint32_t key) { layerKey = key; }
+
+void DisplayList::split() { open = false; }
+
+DrawOp *DisplayList::beginOp(DrawOpType type, uint8_t rotation) {
+  if (opCount == DISPLAY_LIST_MAX_OPS)
+    return nullptr;
+
+  DrawOp *op = &ops[opCount++];
+  *op = {};
+  op->type = type;
+  op->rotation = rotation;
+  op->first = type == DrawOpType::TEXT ? charCount : primCount;
+  op->hash = hashValue(2166136261u, type);
+  op->hash = hashValue(op->hash, rotation);
+  open = true;
+  return op;
+}
+
+bool DisplayList::addPrim(const DrawPrim &prim, const Rect &bounds, bool hashBitmap) {
+  if (primCount == MAX_PRIMS)
+    return false;
+
+  // Bitmaps are ops of their own, other primitives join the open op if it has the same rotation
+  DrawOpType type = prim.type == DrawPrimType::BITMAP || prim.type == DrawPrimType::BITMAP_BG ? DrawOpType::BITMAP : DrawOpType::SHAPE;
+  DrawOp *op = opCount ? &ops[opCount - 1] : nullptr;
+  if (type == DrawOpType::BITMAP || !open || op->type != DrawOpType::SHAPE || op->rotation != prim.rotation)
+    op = beginOp(type, prim.rotation);
+  if (op == nullptr)
+    return false;
+
+  uint32_t hash = op->hash;
+  hash = hashValue(hash, prim.type);
+  hash = hashValue(hash, prim.color);
+  hash = hashValue(hash, prim.bg);
+  hash = hashValue(hash, prim.x);
+  hash = hashValue(hash, prim.y);
+  hash = hashValue(hash, prim.w);
+  hash = hashValue(hash, prim.h);
+  hash = hashValue(hash, prim.bitmap);
+  // A bitmap in RAM can change behind the same pointer, flash bitmaps cannot
+  if (hashBitmap && prim.w > 0 && prim.h > 0)
+    hash = hashBytes(hash, prim.bitmap, (size_t)((prim.w + 7) / 8) * prim.h);
+  op->hash = hash;
+
+  prims[primCount++] = prim;
+  op->count++;
+  op->bounds = rectUnion(op->bounds, bounds);
+  if (type == DrawOpType::BITMAP)
+    open = false;
+  return true;
+}
+
+bool DisplayList::addChar(char c, const DrawOp &style, const Rect &bounds) {
+  if (charCount == MAX_TEXT)
+    return false;
+
+  // Characters continue the open text op if they are printed right where it left the cursor, in the same style
+  DrawOp *op = opCount ? &ops[opCount - 1] : nullptr;
+  bool continues = open && op->type == DrawOpType::TEXT && op->rotation == style.rotation && op->font == style.font &&
+                   op->color == style.color && op->bg == style.bg && op->sizeX == style.sizeX && op->sizeY == style.sizeY &&
+                   op->wrap == style.wrap && op->endX == style.x && op->endY == style.y;
+  if (!continues) {
+    op = beginOp(DrawOpType::TEXT, style.rotation);
+    if (op == nullptr)
+      return false;
+    op->font = style.font;
+    op->color = style.color;
+    op->bg = style.bg;
+    op->sizeX = style.sizeX;
+    op->sizeY = style.sizeY;
+    op->wrap = style.wrap;
+    op->x = style.x;
+    op->y = style.y;
+
+    uint32_t hash = op->hash;
+    hash = hashValue(hash, style.font);
+    hash = hashValue(hash, style.color);
+    hash = hashValue(hash, style.bg);
+    hash = hashValue(hash, style.sizeX);
+    hash = hashValue(hash, style.sizeY);
+    hash = hashValue(hash, style.wrap);
+    hash = hashValue(hash, style.x);
+    hash = hashValue(hash, style.y);
+    op->hash = hash;
+  }
+
+  chars[charCount++] = c;
+  op->count++;
+  op->hash = hashValue(op->hash, c);
+  op->bounds = rectUnion(op->bounds, bounds);
+  op->endX = style.endX;
+  op->endY = style.endY;
+  return true;
+}
+
+void DisplayList::invalidate(const DisplayListState &previous, const Rect &panel, DirtyRegions *dirty, bool replay[]) const {
+  // Nothing to compare against, or a different background: the whole panel is redrawn
+  if (!previous.valid || previous.background != fill || previous.layer != layerKey)
+    dirty->add(panel);
+
+  // Ops are matched by position, a changed op invalidates where it was as well as where it is now
+  uint8_t count = previous.valid && previous.count > opCount ? previous.count : opCount;
+  for (uint8_t i = 0; i < count; i++) {
+    bool before = previous.valid && i < previous.count;
+    bool after = i < opCount;
+    if (before && after && previous.hashes[i] == ops[i].hash && rectEquals(previous.bounds[i], ops[i].bounds))
+      continue;
+    if (before)
+      dirty->add(previous.bounds[i]);
+    if (after)
+      dirty->add(ops[i].bounds);
+  }
+
+  // Clearing a dirty rect wipes every op that overlaps it, and redrawing those may reach into more unchanged ops
+  for (uint8_t i = 0; i < opCount; i++)
+    replay[i] = false;
+
+  bool grown = true;
+  while (grown) {
+    grown = false;
+    for (uint8_t i = 0; i < opCount; i++) {
+      if (replay[i])
+        continue;
+      for (uint8_t j = 0; j < dirty->size(); j++) {
+        if (rectIntersects(ops[i].bounds, (*dirty)[j])) {
+          replay[i] = true;
+          dirty->add(ops[i].bounds);
+          grown = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+void DisplayList::save(DisplayListState *state) const {
+  state->valid = true;
+  state->background = fill;
+  state->layer = layerKey;
+  state->count = opCount;
+  for (uint8_t i = 0; i < opCount; i++) {
+    state->hashes[i] = ops[i].hash;
+    state->bounds[i] = ops[i].bounds;
+  }
+}
+
+uint16_t DisplayList::background() const { return fill; }
+
+uint32_t DisplayList::layer() const { return layerKey; }
+
+uint8_t DisplayList::size() const { return opCount; }
+
+const DrawOp &DisplayList::operator[](uint8_t index) const { return ops[index]; }
+
+const DrawPrim &DisplayList::prim(uint16_t index) const { return prims[index]; }
+
+char DisplayList::text(uint16_t index) const { return chars[index]; }
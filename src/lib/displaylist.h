@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Adafruit_GFX.h"
+
+#include "lib/region.h"
+
+#define DISPLAY_LIST_MAX_OPS 16 // The home screen records 4 ops and the apps menu 6, more falls back to the whole panel
+
+// What a display list drew when it last ended: a hash and the native panel bounds of every op. Small
+// enough to keep in RTC memory, so the first frame after a deep sleep can be diffed as well.
+struct DisplayListState {
+  bool valid;
+  uint16_t background;
+  uint32_t layer;
+  uint8_t count;
+  uint32_t hashes[DISPLAY_LIST_MAX_OPS];
+  Rect bounds[DISPLAY_LIST_MAX_OPS];
+};
+
+enum class DrawOpType : uint8_t { SHAPE, BITMAP, TEXT };
+enum class DrawPrimType : uint8_t { PIXEL, HLINE, VLINE, FILL_RECT, BITMAP, BITMAP_BG };
+
+// One primitive draw call, in the coordinates of the rotation it was made under
+struct DrawPrim {
+  DrawPrimType type;
+  uint8_t rotation;
+  uint16_t color;
+  uint16_t bg;
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  const uint8_t *bitmap;
+};
+
+// The unit that is diffed and replayed: a bitmap, a run of consecutive primitives drawn under one rotation, or a run of
+// characters printed with one font and style. `first` and `count` index the primitives, or the text for TEXT ops.
+struct DrawOp {
+  DrawOpType type;
+  uint8_t rotation;
+  uint16_t first;
+  uint16_t count;
+  uint32_t hash;
+  Rect bounds; // Native panel coordinates
+
+  // TEXT only: the print() state, and the cursor before the first and after the last character
+  const GFXfont *font;
+  uint16_t color;
+  uint16_t bg;
+  uint8_t sizeX;
+  uint8_t sizeY;
+  bool wrap;
+  int16_t x;
+  int16_t y;
+  int16_t endX;
+  int16_t endY;
+};
+
+// The draw calls of one frame, grouped into ops. Comparing the op hashes against the previous frame's
+// DisplayListState tells which panel rects changed without drawing or comparing any pixels.
+class DisplayList {
+public:
+  static const uint16_t MAX_PRIMS = 768;
+  static const uint16_t MAX_TEXT = 384;
+
+  // Starts an empty frame on a screen filled with `background`
+  void clear(uint16_t background);
+  // Key of the background layer the frame is drawn over instead of the fill color, 0 for none
+  void setLayer(uint32_t key);
+  // Ends the current op, the next call starts a new one even if it could have been merged
+  void split();
+  // These return false once the list is full, the call was not recorded then
+  bool addPrim(const DrawPrim &prim, const Rect &bounds, bool hashBitmap);
+  bool addChar(char c, const DrawOp &style, const Rect &bounds);
+
+  // Adds the bounds, old and new, of every op that differs from `previous` to `dirty`, plus those of every op that
+  // overlaps them, and flags the ops that have to be redrawn once the dirty rects are cleared to the background
+  void invalidate(const DisplayListState &previous, const Rect &panel, DirtyRegions *dirty, bool replay[]) const;
+  void save(DisplayListState *state) const;
+
+  uint16_t background() const;
+  uint32_t layer() const;
+  uint8_t size() const;
+  const DrawOp &operator[](uint8_t index) const;
+  const DrawPrim &prim(uint16_t index) const;
+  char text(uint16_t index) const;
+
+private:
+  DrawOp ops[DISPLAY_LIST_MAX_OPS];
+  DrawPrim prims[MAX_PRIMS];
+  char chars[MAX_TEXT];
+  uint8_t opCount = 0;
+  uint16_t primCount = 0;
+  uint16_t charCount = 0;
+  uint16_t fill = 0;
+  uint32_t layerKey = 0;
+  bool open = false;
+
+  DrawOp *beginOp(DrawOpType type, uint8_t rotation);
+};
@@ -0,0 +1,47 @@
+#include "drift.h"
+
+#include "lib/log.h"
+
+// Least squares fit of gain = ppb * span through the origin, so longer spans weigh in more
+static void fit(DriftState *drift) {
+  int64_t gainSpan = 0, spanSpan = 0;
+  for (uint8_t i = 0; i < drift->count; i++) {
+    gainSpan += (int64_t)drift->samples[i].gainUs * drift->samples[i].spanS;
+    spanSpan += (int64_t)drift->samples[i].spanS * drift->samples[i].spanS;
+  }
+  drift->ppb = spanSpan != 0 ? (int32_t)(gainSpan * 1000 / spanSpan) : 0;
+}
+
+void driftSync(DriftState *drift, int64_t localUs, int64_t syncedUs) {
+  if (drift->syncUs != 0) {
+    int64_t span = syncedUs - drift->syncUs;
+    int64_t gain = localUs - syncedUs - drift->appliedUs;
+    if (span >= (int64_t)DRIFT_MIN_SPAN_S * 1000000 && llabs(gain) <= span / 1000000 * DRIFT_MAX_PPM && llabs(gain) <= INT32_MAX) {
+      drift->samples[drift->next] = {(uint32_t)(span / 1000000), (int32_t)gain};
+      drift->next = (drift->next + 1) % DRIFT_SAMPLES;
+      if (drift->count < DRIFT_SAMPLES)
+        drift->count++;
+      fit(drift);
+    }
+    log(LogLevel::INFO, (String("Clock off by ") + String((int32_t)(localUs - syncedUs)) + " us after " + String((int32_t)(span / 1000000)) +
+                         " s, drift " + String(drift->ppb) + " ppb over " + String(drift->count) + " syncs")
+                            .c_str());
+  }
+
+  drift->syncUs = syncedUs;
+  drift->correctedUs = syncedUs;
+  drift->appliedUs = 0;
+}
+
+int32_t driftCorrection(DriftState *drift, int64_t localUs) {
+  if (drift->ppb == 0 || drift->correctedUs == 0)
+    return 0;
+  int32_t correction = -(int32_t)((localUs - drift->correctedUs) * drift->ppb / 1000000000);
+  drift->correctedUs = localUs + correction;
+  drift->appliedUs += correction;
+  return correction;
+}
+
+uint64_t driftSleep(const DriftState &drift, uint64_t sleepUs) { return sleepUs + (int64_t)sleepUs * drift.ppb / 1000000000; }
+
+bool driftFitted(const DriftState &drift) { return drift.count >= DRIFT_MIN_SAMPLES; }
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Arduino.h"
+
+#include "os_config.h"
+
+// How much the local clock gained on NTP time between two syncs, with the corrections made in between taken out
+struct DriftSample {
+  uint32_t spanS;
+  int32_t gainUs;
+};
+
+// The drift of the RTC, fitted over the last DRIFT_SAMPLES syncs and kept across deep sleep. All times are epoch us of
+// the local clock.
+struct DriftState {
+  int64_t syncUs;      // When the last sync set the clock, 0 before the first one
+  int64_t correctedUs; // When the last correction was made, or the last sync
+  int64_t appliedUs;   // Corrections made since the last sync, which add up while syncs keep failing
+  int32_t ppb;         // How fast the local clock runs, in parts per billion, 0 until fitted
+  uint8_t next;
+  uint8_t count;
+  DriftSample samples[DRIFT_SAMPLES];
+};
+
+// Adds the gain since the last sync as a sample and refits, called when a sync set the clock from `localUs` to
+// `syncedUs`. Spans too short to tell drift from sync noise, gains beyond DRIFT_MAX_PPM, and gains too large for a sample
+// after weeks without a sync, are not kept.
+void driftSync(DriftState *drift, int64_t localUs, int64_t syncedUs);
+// What to add to the local clock at `localUs` to take out the drift since the last correction, which the caller has to
+// apply right away
+int32_t driftCorrection(DriftState *drift, int64_t localUs);
+// The sleep timer duration that lasts `sleepUs` of real time, the timer runs on the same clock
+uint64_t driftSleep(const DriftState &drift, uint64_t sleepUs);
+// Whether enough syncs were fitted to rely on the corrections and sync less often
+bool driftFitted(const DriftState &drift);
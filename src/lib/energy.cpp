@@ -0,0 +1,179 @@
+#include "energy.h"
+
+#include "time.h"
+
+#include "lib/log.h"
+
+static const char *const loadNames[] = {"cpu 240", "cpu 80", "light sleep", "panel", "wifi", "deep sleep"};
+static_assert(sizeof(loadNames) / sizeof(loadNames[0]) == (size_t)EnergyLoad::COUNT, "One name per load");
+
+// The current model, what each load draws while it is on
+static const uint32_t loadUa[] = {ENERGY_CPU_240_UA, ENERGY_CPU_80_UA, ENERGY_LIGHT_SLEEP_UA, ENERGY_PANEL_UA, ENERGY_WIFI_UA, ENERGY_DEEP_SLEEP_UA};
+static_assert(sizeof(loadUa) / sizeof(loadUa[0]) == (size_t)EnergyLoad::COUNT, "One current per load");
+
+static EnergyLog *current = nullptr;
+static uint8_t wakeType;
+static uint32_t epochS;
+static uint64_t loadUs[(uint8_t)EnergyLoad::COUNT];
+static EnergyLoad cpu;
+static uint32_t cpuSince;
+static uint8_t on;
+static uint32_t onSince[(uint8_t)EnergyLoad::COUNT];
+
+static uint32_t dayOf(int64_t epochUs) { return (uint32_t)((epochUs / 1000000 + GMT_OFFSET_SEC) / 86400); }
+
+static uint32_t microampHours(uint32_t nAh) { return (nAh + 500) / 1000; }
+
+void energyBegin(EnergyLog *energy, uint8_t type, int64_t nowUs) {
+  uint32_t sinceReset = micros();
+  current = energy;
+  wakeType = type;
+  epochS = (uint32_t)(nowUs / 1000000);
+  memset(loadUs, 0, sizeof(loadUs));
+  on = 0;
+
+  // The chip comes out of reset at full clock. A sleep longer than a day means the clock was set in between.
+  loadUs[(uint8_t)EnergyLoad::CPU_240] = sinceReset;
+  int64_t slept = nowUs - sinceReset - energy->sleptAtUs;
+  if (energy->sleptAtUs != 0 && slept > 0 && slept < 86400LL * 1000000)
+    loadUs[(uint8_t)EnergyLoad::DEEP_SLEEP] = slept;
+  cpu = EnergyLoad::CPU_240;
+  cpuSince = sinceReset;
+}
+
+EnergyLoad energyCpu(EnergyLoad state) {
+  EnergyLoad was = cpu;
+  if (current == nullptr)
+    return was;
+  uint32_t now = micros();
+  loadUs[(uint8_t)cpu] += now - cpuSince;
+  cpu = state;
+  cpuSince = now;
+  return was;
+}
+
+void energySlept(uint32_t us) {
+  if (current == nullptr || cpu == EnergyLoad::LIGHT_SLEEP)
+    return;
+  energyCpu(cpu);
+  us = (uint32_t)min((uint64_t)us, loadUs[(uint8_t)cpu]);
+  loadUs[(uint8_t)cpu] -= us;
+  loadUs[(uint8_t)EnergyLoad::LIGHT_SLEEP] += us;
+}
+
+void energyOn(EnergyLoad load) {
+  if (current == nullptr || (on & (1 << (uint8_t)load)))
+    return;
+  on |= 1 << (uint8_t)load;
+  onSince[(uint8_t)load] = micros();
+}
+
+void energyOff(EnergyLoad load) {
+  if (current == nullptr || !(on & (1 << (uint8_t)load)))
+    return;
+  on &= ~(1 << (uint8_t)load);
+  loadUs[(uint8_t)load] += micros() - onSince[(uint8_t)load];
+}
+
+void energyEnd(int64_t nowUs) {
+  if (current == nullptr)
+    return;
+  energyCpu(cpu);
+  for (uint8_t i = 0; i < (uint8_t)EnergyLoad::COUNT; i++)
+    energyOff((EnergyLoad)i);
+
+  EnergyWake &wake = current->wakes[current->next];
+  wake.epochS = epochS;
+  wake.wakeType = wakeType;
+  for (uint8_t i = 0; i < (uint8_t)EnergyLoad::COUNT; i++)
+    wake.nAh[i] = (uint32_t)(loadUs[i] * loadUa[i] / 3600000);
+  current->sequence++;
+  current->next = (current->next + 1) % ENERGY_WAKES;
+  if (current->count < ENERGY_WAKES)
+    current->count++;
+
+  EnergyDay &today = current->today;
+  if (today.day != dayOf(nowUs)) {
+    memset(&today, 0, sizeof(today));
+    today.day = dayOf(nowUs);
+  }
+  if (wakeType < ENERGY_WAKE_TYPES)
+    today.wakes[wakeType]++;
+  for (uint8_t i = 0; i < (uint8_t)EnergyLoad::COUNT; i++) {
+    today.nAh[i] += wake.nAh[i];
+    if (wakeType < ENERGY_WAKE_TYPES)
+      today.typeNAh[wakeType] += wake.nAh[i];
+  }
+
+  current->sleptAtUs = nowUs;
+  current = nullptr;
+}
+
+bool energyNewDay(const EnergyLog &energy, int64_t nowUs) { return energy.today.day != 0 && energy.today.day != dayOf(nowUs); }
+
+void energyStore(const EnergyLog &energy, EnergyDay days[ENERGY_DAYS]) {
+  if (energy.today.day == 0)
+    return;
+  if (days[ENERGY_DAYS - 1].day != energy.today.day)
+    memmove(&days[0], &days[1], sizeof(EnergyDay) * (ENERGY_DAYS - 1));
+  days[ENERGY_DAYS - 1] = energy.today;
+}
+
+static void reportDay(const EnergyDay &day, const char *const wakeNames[]) {
+  time_t start = (time_t)day.day * 86400;
+  tm date;
+  gmtime_r(&start, &date);
+  char name[16];
+  strftime(name, sizeof(name), "%Y-%m-%d", &date);
+
+  uint32_t total = 0;
+  String types, loads;
+  for (uint8_t type = 0; type < ENERGY_WAKE_TYPES; type++) {
+    total += day.typeNAh[type];
+    types += String(" ") + wakeNames[type] + " " + String(day.wakes[type]) + "x " + String(microampHours(day.typeNAh[type])) + " uAh";
+  }
+  for (uint8_t i = 0; i < (uint8_t)EnergyLoad::COUNT; i++)
+    loads += String(" ") + loadNames[i] + " " + String(microampHours(day.nAh[i])) + " uAh";
+  log(LogLevel::INFO, (String(name) + ": " + String(microampHours(total)) + " uAh, by wake" + types).c_str());
+  log(LogLevel::INFO, (String(name) + ": by load" + loads).c_str());
+}
+
+void energyReport(const EnergyLog &energy, const EnergyDay days[ENERGY_DAYS], const char *const wakeNames[]) {
+  log(LogLevel::INFO, (String("Energy of the last ") + String(energy.count) + " wakes (nAh):").c_str());
+  for (uint8_t n = 0; n < energy.count; n++) {
+    const EnergyWake &wake = energy.wakes[(energy.next + ENERGY_WAKES - energy.count + n) % ENERGY_WAKES];
+    String line = String("#") + String(energy.sequence - energy.count + n + 1) + " " +
+                  (wake.wakeType < ENERGY_WAKE_TYPES ? wakeNames[wake.wakeType] : "?") + " at " + String(wake.epochS) + ":";
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < (uint8_t)EnergyLoad::COUNT; i++) {
+      if (wake.nAh[i] == 0)
+        continue;
+      line += String(" ") + loadNames[i] + " " + String(wake.nAh[i]);
+      total += wake.nAh[i];
+    }
+    log(LogLevel::INFO, (line + ", total " + String(total)).c_str());
+  }
+
+  // The full days in flash, then today from RTC memory, which is newer than its own copy in flash
+  uint64_t pastNAh = 0;
+  uint8_t pastDays = 0;
+  for (uint8_t i = 0; i < ENERGY_DAYS; i++) {
+    if (days[i].day == 0 || days[i].day == energy.today.day)
+      continue;
+    reportDay(days[i], wakeNames);
+    for (uint8_t type = 0; type < ENERGY_WAKE_TYPES; type++)
+      pastNAh += days[i].typeNAh[type];
+    pastDays++;
+  }
+  if (energy.today.day != 0)
+    reportDay(energy.today, wakeNames);
+
+  if (pastDays == 0)
+    return;
+  uint32_t averageUa = (uint32_t)(pastNAh * 3600 / ((uint64_t)pastDays * 86400 * 1000));
+  if (averageUa == 0)
+    return;
+  log(LogLevel::INFO, (String("Average ") + String(averageUa) + " uA over " + String(pastDays) + " days, about " +
+                       String((float)ENERGY_BATTERY_MAH * 1000 / averageUa / 24, 1) + " days on a " + String(ENERGY_BATTERY_MAH) + " mAh battery")
+                          .c_str());
+}
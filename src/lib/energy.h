@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Arduino.h"
+
+#include "os_config.h"
+
+#define ENERGY_WAKES      6 // Wakes kept in RTC memory, the oldest is overwritten
+#define ENERGY_DAYS       7 // Days kept in flash
+#define ENERGY_WAKE_TYPES 3 // Wake types the days are split by, indexed like the wakeType of energyBegin()
+
+// What draws current while the watch is up, and the deep sleep in between. The CPU is in exactly one of CPU_240, CPU_80
+// and LIGHT_SLEEP while awake, PANEL and WIFI come on top of that.
+enum class EnergyLoad : uint8_t { CPU_240, CPU_80, LIGHT_SLEEP, PANEL, WIFI, DEEP_SLEEP, COUNT };
+
+// The charge of one wake and of the deep sleep before it, from the time each load was on and the current model in
+// os_config.h, in nAh
+struct EnergyWake {
+  uint32_t epochS;
+  uint8_t wakeType;
+  uint32_t nAh[(uint8_t)EnergyLoad::COUNT];
+};
+
+// The charge of every wake of one local day
+struct EnergyDay {
+  uint32_t day; // Days since the epoch, 0 if unused
+  uint16_t wakes[ENERGY_WAKE_TYPES];
+  uint32_t nAh[(uint8_t)EnergyLoad::COUNT];
+  uint32_t typeNAh[ENERGY_WAKE_TYPES];
+};
+
+// The last ENERGY_WAKES wakes and today's totals, kept across deep sleep. Finished days go to flash through
+// energyStore().
+struct EnergyLog {
+  int64_t sleptAtUs; // Epoch us the last wake went to deep sleep, 0 before the first one
+  uint32_t sequence;
+  uint8_t next;
+  uint8_t count;
+  EnergyWake wakes[ENERGY_WAKES];
+  EnergyDay today;
+};
+
+// Starts accounting this wake at `nowUs` (epoch us), with the time since reset at 240 MHz and the time since the last
+// wake went to sleep as DEEP_SLEEP
+void energyBegin(EnergyLog *energy, uint8_t wakeType, int64_t nowUs);
+// Switches the CPU to CPU_240, CPU_80 or LIGHT_SLEEP and returns what it was in. Does nothing before energyBegin(),
+// e.g. on the host.
+EnergyLoad energyCpu(EnergyLoad state);
+// Moves `us` the CPU light-slept, without switching to LIGHT_SLEEP, out of the state it is in. The sleep itself runs in
+// the idle task, which only adds up the time, so this is called on the main task once it is done.
+void energySlept(uint32_t us);
+// Turns PANEL or WIFI on or off, it stays on until the wake ends otherwise
+void energyOn(EnergyLoad load);
+void energyOff(EnergyLoad load);
+// Charges the wake to the log and today, starting a new day if `nowUs` is on another one. Called right before deep
+// sleep.
+void energyEnd(int64_t nowUs);
+// Whether `nowUs` is past the day of today's totals, which then have to be stored before the wake ends
+bool energyNewDay(const EnergyLog &energy, int64_t nowUs);
+// Puts today's totals into `days`, the days in flash oldest first, over its own day or as the newest one
+void energyStore(const EnergyLog &energy, EnergyDay days[ENERGY_DAYS]);
+// Logs the last wakes, every day in `days` and today by wake type and by load, and the battery life the average current
+// would give
+void energyReport(const EnergyLog &energy, const EnergyDay days[ENERGY_DAYS], const char *const wakeNames[]);
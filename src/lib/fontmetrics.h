@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "gfxfont.h"
+
+// Glyph table of a GFXfont that can be read in constant expressions. GFXfont itself can't be constexpr
+// since the generated headers cast away the const of the bitmap and glyph arrays.
+struct FontMetrics {
+  const GFXglyph *glyphs;
+  uint16_t first;
+  uint16_t last;
+};
+
+// Inclusive ink bounds of a string relative to its cursor position (the baseline origin), plus the cursor advance.
+// Matches what Adafruit_GFX::getTextBounds() reports for custom fonts with wrapping disabled.
+struct TextExtent {
+  int16_t minX;
+  int16_t minY;
+  int16_t maxX;
+  int16_t maxY;
+  int16_t advance;
+};
+
+constexpr int16_t textWidth(const TextExtent &extent) { return extent.maxX >= extent.minX ? extent.maxX - extent.minX + 1 : 0; }
+
+constexpr int16_t textHeight(const TextExtent &extent) { return extent.maxY >= extent.minY ? extent.maxY - extent.minY + 1 : 0; }
+
+inline FontMetrics fontMetrics(const GFXfont *font) { return {font->glyph, font->first, font->last}; }
+
+// Usable both at compile time (string literals, see TEXT_EXTENT) and at run time. Characters outside of the font range
+// are skipped and zero-sized glyphs still extend the bounds, the same as charBounds() does.
+constexpr TextExtent measureText(const FontMetrics &font, const char *str) {
+  TextExtent extent = {INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN, 0};
+  for (; *str; str++) {
+    uint8_t c = *str;
+    if (c < font.first || c > font.last) {
+      continue;
+    }
+
+    const GFXglyph &glyph = font.glyphs[c - font.first];
+    int16_t x1 = extent.advance + glyph.xOffset;
+    int16_t y1 = glyph.yOffset;
+    int16_t x2 = x1 + glyph.width - 1;
+    int16_t y2 = y1 + glyph.height - 1;
+    extent.minX = x1 < extent.minX ? x1 : extent.minX;
+    extent.minY = y1 < extent.minY ? y1 : extent.minY;
+    extent.maxX = x2 > extent.maxX ? x2 : extent.maxX;
+    extent.maxY = y2 > extent.maxY ? y2 : extent.maxY;
+    extent.advance += glyph.xAdvance;
+  }
+  return extent;
+}
+
+// Extent of a string literal, forced to be evaluated at compile time
+#define TEXT_EXTENT(metrics, str)                                                                                                          \
+  ([] {                                                                                                                                    \
+    constexpr TextExtent extent = measureText(metrics, str);                                                                               \
+    return extent;                                                                                                                         \
+  }())
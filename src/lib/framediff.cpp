@@ -0,0 +1,61 @@
+#include "framediff.h"
+
+#include <string.h>
+
+FrameDiff frameDiff(const uint8_t *prev, const uint8_t *next, int16_t width, int16_t height, const Rect &window) {
+  FrameDiff diff = {{0, 0, 0, 0}, 0};
+
+  Rect area = rectIntersection(window, {0, 0, width, height});
+  if (rectIsEmpty(area))
+    return diff;
+
+  uint16_t rowBytes = (width + 7) / 8;
+  uint16_t firstByte = area.x / 8;
+  uint16_t lastByte = (area.x + area.w - 1) / 8;
+  uint8_t firstMask = 0xFF >> (area.x & 7);
+  uint8_t lastMask = 0xFF << (7 - ((area.x + area.w - 1) & 7));
+  if (firstByte == lastByte)
+    firstMask = lastMask = firstMask & lastMask;
+
+  int16_t minByte = rowBytes, maxByte = -1, minY = -1, maxY = -1;
+  for (int16_t y = area.y; y < area.y + area.h; y++) {
+    const uint8_t *prevRow = prev + y * rowBytes;
+    const uint8_t *nextRow = next + y * rowBytes;
+
+    // Most rows are unchanged between minutes, let memcmp reject them a word at a time
+    if (memcmp(prevRow + firstByte, nextRow + firstByte, lastByte - firstByte + 1) == 0)
+      continue;
+
+    bool rowChanged = false;
+    for (uint16_t b = firstByte; b <= lastByte; b++) {
+      uint8_t changed = prevRow[b] ^ nextRow[b];
+      if (b == firstByte)
+        changed &= firstMask;
+      else if (b == lastByte)
+        changed &= lastMask;
+      if (!changed)
+        continue;
+
+      diff.pixels += __builtin_popcount(changed);
+      if (b < minByte)
+        minByte = b;
+      if (b > maxByte)
+        maxByte = b;
+      rowChanged = true;
+    }
+
+    if (rowChanged) {
+      if (minY < 0)
+        minY = y;
+      maxY = y;
+    }
+  }
+
+  if (maxByte >= 0) {
+    int16_t x2 = (maxByte + 1) * 8;
+    if (x2 > width)
+      x2 = width;
+    diff.bounds = {(int16_t)(minByte * 8), minY, (int16_t)(x2 - minByte * 8), (int16_t)(maxY - minY + 1)};
+  }
+  return diff;
+}
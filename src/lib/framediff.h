@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "lib/region.h"
+
+// Result of comparing two 1 bpp frames, `bounds` is in native (unrotated) frame coordinates and
+// its x range is widened to whole bytes, `pixels` is the number of pixels that flipped
+struct FrameDiff {
+  Rect bounds;
+  uint32_t pixels;
+};
+
+// XORs `prev` against `next` inside `window` and returns the smallest byte-aligned box holding every
+// changed pixel. Both frames use the GFXcanvas1/GxEPD layout: MSB first, rows padded to whole bytes.
+FrameDiff frameDiff(const uint8_t *prev, const uint8_t *next, int16_t width, int16_t height, const Rect &window);
@@ -0,0 +1,106 @@
+#include "layer.h"
+
+#include <string.h>
+
+static bool putRun(uint32_t run, uint8_t *out, uint16_t *size) {
+  for (;;) {
+    if (*size == LAYER_RETAINED_BYTES)
+      return false;
+    uint8_t value = run >= 255 ? 255 : run;
+    out[(*size)++] = value;
+    if (value < 255)
+      return true;
+    run -= 255;
+  }
+}
+
+static void setBits(uint8_t *frame, uint32_t bit, uint32_t count) {
+  for (; count && (bit & 7); bit++, count--)
+    frame[bit >> 3] |= 0x80 >> (bit & 7);
+  memset(frame + (bit >> 3), 0xFF, count >> 3);
+  bit += count & ~7u;
+  for (count &= 7; count; bit++, count--)
+    frame[bit >> 3] |= 0x80 >> (bit & 7);
+}
+
+bool retainLayer(LayerState *state, uint32_t key, const uint8_t *frame, uint16_t frameBytes) {
+  state->valid = false;
+
+  uint16_t size = 0;
+  bool on = false;
+  uint32_t run = 0;
+  for (uint16_t i = 0; i < frameBytes; i++) {
+    uint8_t byte = frame[i];
+    // Backgrounds are mostly whole bytes of one color
+    if (byte == (on ? 0xFF : 0x00)) {
+      run += 8;
+      continue;
+    }
+    for (uint8_t mask = 0x80; mask; mask >>= 1) {
+      if (((byte & mask) != 0) != on) {
+        if (!putRun(run, state->data, &size))
+          return false;
+        on = !on;
+        run = 0;
+      }
+      run++;
+    }
+  }
+  if (!putRun(run, state->data, &size))
+    return false;
+
+  state->size = size;
+  state->key = key;
+  state->valid = true;
+  return true;
+}
+
+bool restoreLayer(const LayerState &state, uint32_t key, uint8_t *frame, uint16_t frameBytes) {
+  if (!state.valid || state.key != key)
+    return false;
+
+  memset(frame, 0, frameBytes);
+  uint32_t bit = 0, total = (uint32_t)frameBytes * 8;
+  bool on = false;
+  for (uint16_t i = 0; i < state.size && bit < total;) {
+    uint32_t run = 0;
+    uint8_t value;
+    do {
+      value = state.data[i++];
+      run += value;
+    } while (value == 255 && i < state.size);
+
+    if (run > total - bit)
+      run = total - bit;
+    if (on)
+      setBits(frame, bit, run);
+    bit += run;
+    on = !on;
+  }
+  return true;
+}
+
+void copyLayerRect(const uint8_t *src, uint8_t *dst, int16_t width, int16_t height, const Rect &rect) {
+  Rect area = rectIntersection(rect, {0, 0, width, height});
+  if (rectIsEmpty(area))
+    return;
+
+  uint16_t rowBytes = (width + 7) / 8;
+  uint16_t firstByte = area.x / 8;
+  uint16_t lastByte = (area.x + area.w - 1) / 8;
+  uint8_t firstMask = 0xFF >> (area.x & 7);
+  uint8_t lastMask = 0xFF << (7 - ((area.x + area.w - 1) & 7));
+  if (firstByte == lastByte)
+    firstMask = lastMask = firstMask & lastMask;
+
+  for (int16_t y = area.y; y < area.y + area.h; y++) {
+    const uint8_t *srcRow = src + y * rowBytes;
+    uint8_t *dstRow = dst + y * rowBytes;
+    dstRow[firstByte] = (dstRow[firstByte] & ~firstMask) | (srcRow[firstByte] & firstMask);
+    if (lastByte == firstByte)
+      continue;
+    if (lastByte > firstByte + 1)
+      memcpy(dstRow + firstByte + 1, srcRow + firstByte + 1, lastByte - firstByte - 1);
+    dstRow[lastByte] = (dstRow[lastByte] & ~lastMask) | (srcRow[lastByte] & lastMask);
+  }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "lib/region.h"
+
+#define LAYER_RETAINED_BYTES 1280
+
+// A background layer kept across deep sleep: the frame it was drawn into, run-length encoded like GFXFONT_RLE glyphs
+// (alternating runs of clear and set bits, 255 continues a run), and the key of the inputs it was drawn from. Only
+// layers that compress into LAYER_RETAINED_BYTES are kept, others are redrawn on every wake.
+struct LayerState {
+  bool valid;
+  uint32_t key;
+  uint16_t size;
+  uint8_t data[LAYER_RETAINED_BYTES];
+};
+
+// Encodes a 1 bpp frame into `state`, leaving it invalid if it does not fit
+bool retainLayer(LayerState *state, uint32_t key, const uint8_t *frame, uint16_t frameBytes);
+// Decodes `state` into a 1 bpp frame if it holds a layer drawn from `key`
+bool restoreLayer(const LayerState &state, uint32_t key, uint8_t *frame, uint16_t frameBytes);
+
+// Copies the pixels inside `rect` (native coordinates) from one 1 bpp frame to another, whole rows at a time
+void copyLayerRect(const uint8_t *src, uint8_t *dst, int16_t width, int16_t height, const Rect &rect);
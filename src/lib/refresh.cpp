@@ -0,0 +1,45 @@
+#include "refresh.h"
+
+// Only the minute wake decides, and it has no serial unless BOOT_LOG_LIGHT_WAKES, so the line isn't even built then
+static RefreshMode logDecision(RefreshState *state, RefreshMode mode, uint32_t changedPixels, const char *reason) {
+  if (!BOOT_LOG_LIGHT_WAKES)
+    return mode;
+  const char *modeStr = mode == RefreshMode::FULL ? "FULL" : mode == RefreshMode::PARTIAL ? "PARTIAL" : "NONE";
+  log(LogLevel::INFO, (String("Refresh ") + modeStr + " (" + reason + ") : " + String(changedPixels) + " px changed, " + String(state->partials) +
+                       " partials / " + String(state->area) + " px since full")
+                          .c_str());
+  return mode;
+}
+
+RefreshMode decideRefresh(RefreshState *state, uint32_t changedPixels, bool panelValid, int minute) {
+  if (!panelValid)
+    return logDecision(state, RefreshMode::FULL, changedPixels, "panel not showing home");
+  if (changedPixels == 0)
+    return logDecision(state, RefreshMode::NONE, changedPixels, "no change");
+  if (REFRESH_FULL_ON_HOUR && minute == 0)
+    return logDecision(state, RefreshMode::FULL, changedPixels, "top of hour");
+  if (state->partials >= REFRESH_MAX_PARTIALS)
+    return logDecision(state, RefreshMode::FULL, changedPixels, "partial count");
+  if (state->area + changedPixels > REFRESH_MAX_AREA)
+    return logDecision(state, RefreshMode::FULL, changedPixels, "partial area");
+  return logDecision(state, RefreshMode::PARTIAL, changedPixels, "within limits");
+}
+
+void recordRefresh(RefreshState *state, RefreshMode mode, uint32_t changedPixels) {
+  switch (mode) {
+  case RefreshMode::NONE:
+    break;
+  case RefreshMode::PARTIAL:
+    state->partials++;
+    state->area += changedPixels;
+    break;
+  case RefreshMode::FULL:
+    state->partials = 0;
+    state->area = 0;
+    break;
+  }
+}
+
+RefreshCost refreshCost(const RefreshState *state) {
+  return calibratedRefreshCost(state->calibration, {REFRESH_WINDOW_US, REFRESH_BYTE_NS, REFRESH_BUSY_US});
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Arduino.h"
+
+#include "lib/log.h"
+#include "lib/refreshplan.h"
+#include "os_config.h"
+
+enum class RefreshMode { NONE, PARTIAL, FULL };
+
+// Ghosting counters since the last full refresh and the timing fit of partial refreshes, kept across deep sleep
+struct RefreshState {
+  uint16_t partials;
+  uint32_t area;
+  RefreshCalibration calibration;
+};
+
+// Picks between no refresh, a partial updateWindow() and a full update() for the next frame
+RefreshMode decideRefresh(RefreshState *state, uint32_t changedPixels, bool panelValid, int minute);
+void recordRefresh(RefreshState *state, RefreshMode mode, uint32_t changedPixels);
+// The updateWindow() cost model for planRefresh(), os_config.h defaults until this panel's timings are known
+RefreshCost refreshCost(const RefreshState *state);
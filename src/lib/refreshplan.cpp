@@ -0,0 +1,148 @@
+#include "refreshplan.h"
+
+#include <string.h>
+
+#include "lib/framediff.h"
+
+// Fewer samples than this, or too little spread in window size, and the fit is noise
+#define CALIBRATION_MIN_SAMPLES 8
+
+// Split candidates before merging, a dirty rect rarely breaks into more than a few bands
+#define MAX_CANDIDATES 32
+
+uint32_t windowBytes(const Rect &window) {
+  if (rectIsEmpty(window))
+    return 0;
+  uint32_t rowBytes = (window.x + window.w + 7) / 8 - window.x / 8;
+  return rowBytes * window.h;
+}
+
+uint32_t windowCost(const Rect &window, const RefreshCost &cost) {
+  return cost.windowUs + cost.busyUs + (uint32_t)((uint64_t)windowBytes(window) * cost.byteNs / 1000);
+}
+
+void addRefreshSample(RefreshCalibration *calibration, uint32_t bytes, uint32_t totalUs, uint32_t busyUs) {
+  double transferUs = (double)totalUs - busyUs;
+  calibration->samples++;
+  calibration->bytes += bytes;
+  calibration->bytesSquared += (double)bytes * bytes;
+  calibration->transferUs += transferUs;
+  calibration->bytesTransferUs += (double)bytes * transferUs;
+  if (busyUs > 0) {
+    calibration->busySamples++;
+    calibration->busyUs += busyUs;
+  }
+}
+
+RefreshCost calibratedRefreshCost(const RefreshCalibration &calibration, const RefreshCost &defaults) {
+  double n = calibration.samples;
+  double spread = n * calibration.bytesSquared - calibration.bytes * calibration.bytes;
+  if (calibration.samples < CALIBRATION_MIN_SAMPLES || spread <= 0)
+    return defaults;
+
+  // Ordinary least squares of transfer time against window bytes
+  double slope = (n * calibration.bytesTransferUs - calibration.bytes * calibration.transferUs) / spread;
+  double intercept = (calibration.transferUs - slope * calibration.bytes) / n;
+
+  RefreshCost cost;
+  cost.windowUs = intercept > 0 ? (uint32_t)intercept : 0;
+  cost.byteNs = slope > 0 ? (uint32_t)(slope * 1000) : 0;
+  // Without separate BUSY timings the waveform time is already part of the intercept
+  cost.busyUs = calibration.busySamples ? (uint32_t)(calibration.busyUs / calibration.busySamples) : 0;
+  return cost;
+}
+
+// Splits `window` into runs of rows with changed pixels, each trimmed to the changed columns
+static void splitChanged(const uint8_t *prev, const uint8_t *next, int16_t width, int16_t height, const Rect &window, Rect *candidates,
+                         uint8_t *count) {
+  uint16_t rowBytes = (width + 7) / 8;
+  uint16_t firstByte = window.x / 8;
+  uint16_t bytes = (window.x + window.w + 7) / 8 - firstByte;
+
+  int16_t bandStart = -1;
+  for (int16_t y = window.y; y <= window.y + window.h; y++) {
+    bool changed = y < window.y + window.h && memcmp(prev + y * rowBytes + firstByte, next + y * rowBytes + firstByte, bytes) != 0;
+    if (changed && bandStart < 0) {
+      bandStart = y;
+    } else if (!changed && bandStart >= 0) {
+      Rect band = {window.x, bandStart, window.w, (int16_t)(y - bandStart)};
+      FrameDiff diff = frameDiff(prev, next, width, height, band);
+      if (!rectIsEmpty(diff.bounds)) {
+        // Out of room, fold into the last band rather than dropping pixels
+        if (*count == MAX_CANDIDATES)
+          candidates[*count - 1] = rectUnion(candidates[*count - 1], diff.bounds);
+        else
+          candidates[(*count)++] = diff.bounds;
+      }
+      bandStart = -1;
+    }
+  }
+}
+
+static uint32_t totalCost(const Rect *windows, uint8_t count, const RefreshCost &cost) {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < count; i++)
+    total += windowCost(windows[i], cost);
+  return total;
+}
+
+void planRefresh(const uint8_t *prev, const uint8_t *next, int16_t width, int16_t height, const DirtyRegions &dirty, const RefreshCost &cost,
+                 RefreshPlan *plan) {
+  // Two fallbacks for when merging pairs gets stuck: every dirty rect trimmed on its own, and one window around all of them
+  Rect trimmed[DirtyRegions::MAX_RECTS];
+  uint8_t trimmedCount = 0;
+  Rect bounding = {0, 0, 0, 0};
+
+  Rect windows[MAX_CANDIDATES];
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < dirty.size(); i++) {
+    Rect window = panelWindow(dirty[i], 0, width, height);
+    if (rectIsEmpty(window))
+      continue;
+
+    Rect changed = frameDiff(prev, next, width, height, window).bounds;
+    if (rectIsEmpty(changed))
+      continue;
+    trimmed[trimmedCount++] = changed;
+    bounding = rectUnion(bounding, changed);
+    splitChanged(prev, next, width, height, changed, windows, &count);
+  }
+
+  // Greedily merge the pair that saves the most, a merged window can swallow others and make them free to merge next
+  while (count > 1) {
+    int32_t bestSaving = INT32_MIN;
+    uint8_t bestA = 0, bestB = 0;
+    for (uint8_t a = 0; a < count; a++) {
+      for (uint8_t b = a + 1; b < count; b++) {
+        int32_t separate = windowCost(windows[a], cost) + windowCost(windows[b], cost);
+        int32_t saving = separate - (int32_t)windowCost(rectUnion(windows[a], windows[b]), cost);
+        if (saving > bestSaving) {
+          bestSaving = saving;
+          bestA = a;
+          bestB = b;
+        }
+      }
+    }
+    if (bestSaving <= 0 && count <= REFRESH_PLAN_MAX_WINDOWS)
+      break;
+
+    windows[bestA] = rectUnion(windows[bestA], windows[bestB]);
+    windows[bestB] = windows[--count];
+  }
+
+  uint32_t best = totalCost(windows, count, cost);
+  if (trimmedCount > 0 && trimmedCount <= REFRESH_PLAN_MAX_WINDOWS && totalCost(trimmed, trimmedCount, cost) < best) {
+    memcpy(windows, trimmed, sizeof(Rect) * trimmedCount);
+    count = trimmedCount;
+    best = totalCost(windows, count, cost);
+  }
+  if (count > 1 && windowCost(bounding, cost) < best) {
+    windows[0] = bounding;
+    count = 1;
+    best = windowCost(bounding, cost);
+  }
+
+  plan->count = count;
+  plan->costUs = best;
+  memcpy(plan->windows, windows, sizeof(Rect) * count);
+}
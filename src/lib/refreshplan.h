@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "lib/region.h"
+
+#define REFRESH_PLAN_MAX_WINDOWS 8
+
+// Time one updateWindow() takes, in microseconds: windowUs + bytes * byteNs / 1000 + busyUs, where `bytes` is the
+// window's size in the 1 bpp frame. Only the fixed part (windowUs + busyUs) and the per-byte part matter to the planner.
+struct RefreshCost {
+  uint32_t windowUs; // Commands and RAM window setup
+  uint32_t byteNs;   // Copying and sending the window, per byte
+  uint32_t busyUs;   // Waveform time with BUSY asserted
+};
+
+// Running least squares sums over measured updateWindow() timings, kept across deep sleep
+struct RefreshCalibration {
+  uint32_t samples;
+  uint32_t busySamples;
+  double bytes;
+  double bytesSquared;
+  double transferUs;
+  double bytesTransferUs;
+  double busyUs;
+};
+
+// Panel windows to refresh, in native coordinates and in order, with their estimated total time
+struct RefreshPlan {
+  Rect windows[REFRESH_PLAN_MAX_WINDOWS];
+  uint8_t count;
+  uint32_t costUs;
+};
+
+uint32_t windowBytes(const Rect &window);
+uint32_t windowCost(const Rect &window, const RefreshCost &cost);
+
+// Adds one timed updateWindow() of `bytes` bytes. Pass busyUs = 0 when BUSY was not timed separately, the fixed
+// cost is then fitted as a whole into windowUs.
+void addRefreshSample(RefreshCalibration *calibration, uint32_t bytes, uint32_t totalUs, uint32_t busyUs);
+// The cost model fitted to the samples so far, `defaults` until there are enough of them
+RefreshCost calibratedRefreshCost(const RefreshCalibration &calibration, const RefreshCost &defaults);
+
+// Finds the cheapest set of windows covering every pixel that differs between the `prev` and `next` frames inside
+// the dirty rects (native coordinates). Each dirty rect is first split into bands of changed rows trimmed to their
+// changed columns, then the pair of windows whose bounding window saves the most time is merged until no merge saves
+// any, or while there are more windows than a plan holds. Pairwise merging can stop short of a cheaper plan, so the
+// trimmed dirty rects on their own and a single window around all of them are considered as well.
+void planRefresh(const uint8_t *prev, const uint8_t *next, int16_t width, int16_t height, const DirtyRegions &dirty, const RefreshCost &cost,
+                 RefreshPlan *plan);
@@ -0,0 +1,91 @@
+#include "region.h"
+
+bool rectIsEmpty(const Rect &rect) { return rect.w <= 0 || rect.h <= 0; }
+
+bool rectIntersects(const Rect &a, const Rect &b) {
+  if (rectIsEmpty(a) || rectIsEmpty(b))
+    return false;
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+Rect rectUnion(const Rect &a, const Rect &b) {
+  if (rectIsEmpty(a))
+    return b;
+  if (rectIsEmpty(b))
+    return a;
+
+  int16_t x1 = a.x < b.x ? a.x : b.x;
+  int16_t y1 = a.y < b.y ? a.y : b.y;
+  int16_t x2 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+  int16_t y2 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+  return {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+}
+
+Rect rectIntersection(const Rect &a, const Rect &b) {
+  int16_t x1 = a.x > b.x ? a.x : b.x;
+  int16_t y1 = a.y > b.y ? a.y : b.y;
+  int16_t x2 = a.x + a.w < b.x + b.w ? a.x + a.w : b.x + b.w;
+  int16_t y2 = a.y + a.h < b.y + b.h ? a.y + a.h : b.y + b.h;
+  if (x2 <= x1 || y2 <= y1)
+    return {0, 0, 0, 0};
+  return {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+}
+
+Rect rotateRect(const Rect &rect, uint8_t rotation, int16_t panelWidth, int16_t panelHeight) {
+  // Same transforms as the GxEPD/GFXcanvas1 drawPixel() rotation switch, applied to the whole rect
+  switch (rotation & 3) {
+  case 1:
+    return {(int16_t)(panelWidth - rect.y - rect.h), rect.x, rect.h, rect.w};
+  case 2:
+    return {(int16_t)(panelWidth - rect.x - rect.w), (int16_t)(panelHeight - rect.y - rect.h), rect.w, rect.h};
+  case 3:
+    return {rect.y, (int16_t)(panelHeight - rect.x - rect.w), rect.h, rect.w};
+  default:
+    return rect;
+  }
+}
+
+Rect panelWindow(const Rect &rect, uint8_t rotation, int16_t panelWidth, int16_t panelHeight) {
+  Rect native = rotateRect(rect, rotation, panelWidth, panelHeight);
+  native = rectIntersection(native, {0, 0, panelWidth, panelHeight});
+  if (rectIsEmpty(native))
+    return native;
+
+  int16_t x1 = native.x & ~7;
+  int16_t x2 = (native.x + native.w + 7) & ~7;
+  if (x2 > panelWidth)
+    x2 = panelWidth;
+  native.x = x1;
+  native.w = x2 - x1;
+  return native;
+}
+
+void DirtyRegions::add(const Rect &rect) {
+  if (rectIsEmpty(rect))
+    return;
+
+  // Merge with every rect it touches, repeating since the grown rect may now reach others
+  Rect merged = rect;
+  for (uint8_t i = 0; i < count;) {
+    if (rectIntersects(merged, rects[i])) {
+      merged = rectUnion(merged, rects[i]);
+      rects[i] = rects[--count];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  // Out of slots, fold into the last rect rather than dropping an invalidation
+  if (count == MAX_RECTS) {
+    rects[count - 1] = rectUnion(rects[count - 1], merged);
+    return;
+  }
+  rects[count++] = merged;
+}
+
+void DirtyRegions::clear() { count = 0; }
+
+uint8_t DirtyRegions::size() const { return count; }
+
+const Rect &DirtyRegions::operator[](uint8_t index) const { return rects[index]; }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+// A rectangle in display pixels, empty when w or h is not positive
+struct Rect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+bool rectIsEmpty(const Rect &rect);
+bool rectIntersects(const Rect &a, const Rect &b);
+Rect rectUnion(const Rect &a, const Rect &b);
+Rect rectIntersection(const Rect &a, const Rect &b);
+
+// Maps a rect drawn under `rotation` to the panel's native coordinates
+Rect rotateRect(const Rect &rect, uint8_t rotation, int16_t panelWidth, int16_t panelHeight);
+// rotateRect(), clipped to the panel and widened so that its native x range starts and ends on a byte (8 pixel) boundary
+Rect panelWindow(const Rect &rect, uint8_t rotation, int16_t panelWidth, int16_t panelHeight);
+
+// A small fixed list of invalidated rects, overlapping rects are merged on insertion
+class DirtyRegions {
+public:
+  static const uint8_t MAX_RECTS = 8;
+
+  void add(const Rect &rect);
+  void clear();
+  uint8_t size() const;
+  const Rect &operator[](uint8_t index) const;
+
+private:
+  Rect rects[MAX_RECTS];
+  uint8_t count = 0;
+};
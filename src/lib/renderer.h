@@ -0,0 +1,580 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "gfxfont.h"
+#include "lib/asset.h"
+
+// The drawing calls src/ makes through Adafruit_GFX (rects, circles, bitmaps, assets and text in custom fonts), without a
+// virtual call, rotation switch or bounds check per pixel. Renderer holds the algorithms and hands every rect it fills
+// to the target type given as Derived, which fixes the frame size and rotation at compile time, so each call inlines
+// down to mask and byte operations on the frame. Derived provides width(), height(), ROTATION, toNative(), fill() in
+// screen coordinates, fillNative() in panel coordinates and writeSpanMask() for up to 32 pixels of a screen row, all
+// clipped. Colors are 0 for clear and anything else for set.
+// Text is sized, wrapped and measured the way Adafruit_GFX does it for custom fonts, the built-in 5x7 font is not
+// supported.
+template <class Derived> class Renderer {
+public:
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { target().fill(x, y, 1, 1, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { target().fill(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { target().fill(x, y, 1, h, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w > 0)
+      target().fill(x, y, w, h, color);
+  }
+  void fillScreen(uint16_t color) { target().fill(0, 0, Derived::width(), Derived::height(), color); }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  // Same pixels as Adafruit_GFX::drawRoundRect() and fillRoundRect()
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    int16_t maxRadius = ((w < h) ? w : h) / 2;
+    if (r > maxRadius)
+      r = maxRadius;
+    drawFastHLine(x + r, y, w - 2 * r, color);
+    drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+    drawFastVLine(x, y + r, h - 2 * r, color);
+    drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+    drawCorners(x + r, y + r, w - 2 * r - 1, h - 2 * r - 1, r, color);
+  }
+
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    int16_t maxRadius = ((w < h) ? w : h) / 2;
+    if (r > maxRadius)
+      r = maxRadius;
+    fillRect(x + r, y, w - 2 * r, h, color);
+    fillCorners(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+    fillCorners(x + r, y + r, r, 2, h - 2 * r - 1, color);
+  }
+
+  // Same pixels as Adafruit_GFX::drawCircle() and fillCircle()
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drawPixel(x0, y0 + r, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    drawCorners(x0, y0, 0, 0, r, color);
+  }
+
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCorners(x0, y0, r, 3, 0, color);
+  }
+
+  // drawBitmap() layout: rows padded to whole bytes, MSB first. Every 32 pixels of a row go out as one mask, with `bg`
+  // the clear bits as a second one.
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+    drawBitmapMasks(x, y, bitmap, w, h, color, color, false);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    drawBitmapMasks(x, y, bitmap, w, h, color, bg, true);
+  }
+
+  // Same pixels as drawAsset() in lib/asset.h
+  void drawAsset(int16_t x, int16_t y, const Asset &asset, uint16_t color) {
+    int16_t w = asset.width, h = asset.height;
+    bool rle = asset.encoding == AssetEncoding::RLE;
+    if (!asset.native) {
+      if (rle)
+        forEachGlyphRun(asset.data, w, h, true, [&](int16_t sx, int16_t sy, int16_t n) { target().fill(x + sx, y + sy, n, 1, color); });
+      else
+        drawBitmap(x, y, asset.data, w, h, color);
+      return;
+    }
+
+    int16_t sw = (asset.rotation & 1) ? h : w;
+    int16_t sh = (asset.rotation & 1) ? w : h;
+    if (asset.rotation == Derived::ROTATION) {
+      // Stored rows are panel rows
+      int16_t nx, ny, nw, nh;
+      Derived::toNative(x, y, w, h, nx, ny, nw, nh);
+      forEachImageRun(asset.data, sw, sh, rle, [&](int16_t sx, int16_t sy, int16_t n) { target().fillNative(nx + sx, ny + sy, n, 1, color); });
+    } else {
+      forEachImageRun(asset.data, sw, sh, rle, [&](int16_t sx, int16_t sy, int16_t n) {
+        for (; n > 0; n--, sx++) {
+          int16_t i, j;
+          unrotate(asset.rotation, w, h, sx, sy, i, j);
+          target().fill(x + i, y + j, 1, 1, color);
+        }
+      });
+    }
+  }
+
+  void setFont(const GFXfont *f) { font = f; }
+  const GFXfont *getFont() const { return font; }
+  void setTextColor(uint16_t c) { textColor = c; }
+  void setTextSize(uint8_t s) { textSize = s > 0 ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+  void setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+  }
+  int16_t getCursorX() const { return cursorX; }
+  int16_t getCursorY() const { return cursorY; }
+
+  // Draws a glyph of the current font with its baseline origin at (x, y), like Adafruit_GFX::drawChar() does for
+  // custom fonts. At size 1, fonts pre-rotated for ROTATION are written in panel order.
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size = 1) {
+    if (font == nullptr || c < font->first || c > font->last)
+      return;
+    const GFXglyph *glyph = font->glyph + (c - font->first);
+    const uint8_t *bitmap = font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+    int16_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+    int16_t gx = x + (int8_t)pgm_read_byte(&glyph->xOffset) * size, gy = y + (int8_t)pgm_read_byte(&glyph->yOffset) * size;
+    if (w == 0 || h == 0)
+      return;
+
+    uint8_t format = pgm_read_byte(&font->format);
+    uint8_t fr = GFXFONT_ROTATION(format);
+    bool rotated = GFXFONT_IS_ROTATED(format);
+    int16_t sw = (rotated && (fr & 1)) ? h : w;
+    int16_t sh = (rotated && (fr & 1)) ? w : h;
+    bool rle = (format & GFXFONT_ENCODING) == GFXFONT_RLE;
+
+    if (!rotated) {
+      forEachGlyphRun(bitmap, sw, sh, rle,
+                      [&](int16_t sx, int16_t sy, int16_t n) { target().fill(gx + sx * size, gy + sy * size, n * size, size, color); });
+    } else if (fr == Derived::ROTATION && size == 1) {
+      // Stored rows are panel rows
+      int16_t nx, ny, nw, nh;
+      Derived::toNative(gx, gy, w, h, nx, ny, nw, nh);
+      forEachGlyphRun(bitmap, sw, sh, rle, [&](int16_t sx, int16_t sy, int16_t n) { target().fillNative(nx + sx, ny + sy, n, 1, color); });
+    } else {
+      // Stored for another rotation or scaled, turn every pixel back upright
+      forEachGlyphRun(bitmap, sw, sh, rle, [&](int16_t sx, int16_t sy, int16_t n) {
+        for (; n > 0; n--, sx++) {
+          int16_t i, j;
+          unrotate(fr, w, h, sx, sy, i, j);
+          target().fill(gx + i * size, gy + j * size, size, size, color);
+        }
+      });
+    }
+  }
+
+  size_t write(uint8_t c) {
+    if (font == nullptr)
+      return 0;
+    if (c == '\n') {
+      cursorX = 0;
+      cursorY += textSize * pgm_read_byte(&font->yAdvance);
+    } else if (c != '\r' && c >= font->first && c <= font->last) {
+      const GFXglyph *glyph = font->glyph + (c - font->first);
+      int16_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+      if (w > 0 && h > 0) {
+        int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset);
+        if (wrap && cursorX + textSize * (xo + w) > Derived::width()) {
+          cursorX = 0;
+          cursorY += textSize * pgm_read_byte(&font->yAdvance);
+        }
+        drawChar(cursorX, cursorY, c, textColor, textSize);
+      }
+      cursorX += textSize * pgm_read_byte(&glyph->xAdvance);
+    }
+    return 1;
+  }
+
+  size_t print(const char *str) {
+    size_t n = 0;
+    for (; *str; str++)
+      n += write(*str);
+    return n;
+  }
+
+  // Same box as Adafruit_GFX::getTextBounds() gives for `str` printed from (x, y)
+  void getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) const {
+    int16_t minX = Derived::width(), minY = Derived::height(), maxX = -1, maxY = -1;
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    if (font == nullptr)
+      return;
+    for (; *str; str++)
+      charBounds(*str, &x, &y, &minX, &minY, &maxX, &maxY);
+    if (maxX >= minX) {
+      *x1 = minX;
+      *w = maxX - minX + 1;
+    }
+    if (maxY >= minY) {
+      *y1 = minY;
+      *h = maxY - minY + 1;
+    }
+  }
+
+protected:
+  const GFXfont *font = nullptr;
+  int16_t cursorX = 0;
+  int16_t cursorY = 0;
+  uint16_t textColor = 1;
+  uint8_t textSize = 1;
+  bool wrap = true;
+
+private:
+  Derived &target() { return static_cast<Derived &>(*this); }
+
+  // Where stored pixel (sx, sy) of a w x h image, pre-rotated by `rotation`, lies upright
+  static void unrotate(uint8_t rotation, int16_t w, int16_t h, int16_t sx, int16_t sy, int16_t &i, int16_t &j) {
+    i = sx;
+    j = sy;
+    switch (rotation) {
+    case 1:
+      i = sy;
+      j = h - 1 - sx;
+      break;
+    case 2:
+      i = w - 1 - sx;
+      j = h - 1 - sy;
+      break;
+    case 3:
+      i = w - 1 - sy;
+      j = sx;
+      break;
+    }
+  }
+
+  // Adafruit_GFX::charBounds() for custom fonts: moves the cursor (x, y) past `c` and grows the box by its glyph
+  void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minX, int16_t *minY, int16_t *maxX, int16_t *maxY) const {
+    if (c == '\n') {
+      *x = 0;
+      *y += textSize * pgm_read_byte(&font->yAdvance);
+      return;
+    }
+    if (c == '\r' || c < font->first || c > font->last)
+      return;
+    const GFXglyph *glyph = font->glyph + (c - font->first);
+    int16_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+    int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset), yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+    if (wrap && *x + (xo + w) * textSize > Derived::width()) {
+      *x = 0;
+      *y += textSize * pgm_read_byte(&font->yAdvance);
+    }
+    int16_t left = *x + xo * textSize, top = *y + yo * textSize;
+    int16_t right = left + w * textSize - 1, bottom = top + h * textSize - 1;
+    if (left < *minX)
+      *minX = left;
+    if (top < *minY)
+      *minY = top;
+    if (right > *maxX)
+      *maxX = right;
+    if (bottom > *maxY)
+      *maxY = bottom;
+    *x += textSize * pgm_read_byte(&glyph->xAdvance);
+  }
+
+  // An image in either asset encoding: RAW rows padded to whole bytes, or one RLE stream
+  template <typename Span> static void forEachImageRun(const uint8_t *data, int16_t width, int16_t height, bool rle, Span span) {
+    if (rle) {
+      forEachGlyphRun(data, width, height, true, span);
+      return;
+    }
+    int16_t stride = (width + 7) / 8;
+    for (int16_t y = 0; y < height; y++) {
+      const uint8_t *row = data + y * stride;
+      int16_t run = -1;
+      for (int16_t x = 0; x <= width; x++) {
+        bool on = x < width && (pgm_read_byte(&row[x >> 3]) & (0x80 >> (x & 7)));
+        if (on) {
+          if (run < 0)
+            run = x;
+        } else if (run >= 0) {
+          span(run, y, x - run);
+          run = -1;
+        }
+      }
+    }
+  }
+
+  // The four corner arcs of drawRoundRect(), centered `dx` and `dy` apart
+  void drawCorners(int16_t x0, int16_t y0, int16_t dx, int16_t dy, int16_t r, uint16_t color) {
+    int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddFy += 2;
+        f += ddFy;
+      }
+      x++;
+      ddFx += 2;
+      f += ddFx;
+      drawPixel(x0 + dx + x, y0 + dy + y, color);
+      drawPixel(x0 + dx + y, y0 + dy + x, color);
+      drawPixel(x0 + dx + x, y0 - y, color);
+      drawPixel(x0 + dx + y, y0 - x, color);
+      drawPixel(x0 - y, y0 + dy + x, color);
+      drawPixel(x0 - x, y0 + dy + y, color);
+      drawPixel(x0 - y, y0 - x, color);
+      drawPixel(x0 - x, y0 - y, color);
+    }
+  }
+
+  // Adafruit_GFX::fillCircleHelper()
+  void fillCorners(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+    int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r, px = x, py = y;
+    delta++;
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddFy += 2;
+        f += ddFy;
+      }
+      x++;
+      ddFx += 2;
+      f += ddFx;
+      if (x < (y + 1)) {
+        if (corners & 1)
+          drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+        if (corners & 2)
+          drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+      }
+      if (y != py) {
+        if (corners & 1)
+          drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+        if (corners & 2)
+          drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+        py = y;
+      }
+      px = x;
+    }
+  }
+
+  // Adafruit_GFX::writeBitmapSpans()
+  void drawBitmapMasks(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool opaque) {
+    int16_t stride = (w + 7) / 8;
+    for (int16_t j = 0; j < h; j++) {
+      const uint8_t *row = bitmap + j * stride;
+      for (int16_t i = 0; i < w; i += 32) {
+        int16_t n = (w - i < 32) ? w - i : 32;
+        uint32_t mask = 0;
+        for (int16_t k = 0; k < (n + 7) / 8; k++)
+          mask |= (uint32_t)pgm_read_byte(&row[i / 8 + k]) << (24 - 8 * k);
+        uint32_t used = (n < 32) ? ~(0xFFFFFFFFUL >> n) : 0xFFFFFFFFUL;
+        target().writeSpanMask(x + i, y + j, n, mask & used, color);
+        if (opaque)
+          target().writeSpanMask(x + i, y + j, n, ~mask & used, bg);
+      }
+    }
+  }
+
+  // Calls span(x, y, n) for every run of set pixels of a glyph bitmap, see gfxfont.h for both encodings
+  template <typename Span> static void forEachGlyphRun(const uint8_t *bitmap, int16_t width, int16_t height, bool rle, Span span) {
+    if (rle) {
+      bool on = false;
+      int16_t x = 0, y = 0;
+      while (y < height) {
+        uint16_t len = 0;
+        uint8_t value;
+        do {
+          value = pgm_read_byte(bitmap++);
+          len += value;
+        } while (value == 255);
+
+        while (len) {
+          int16_t n = ((int16_t)len < width - x) ? (int16_t)len : width - x;
+          if (on)
+            span(x, y, n);
+          len -= n;
+          if ((x += n) == width) {
+            x = 0;
+            y++;
+          }
+        }
+        on = !on;
+      }
+      return;
+    }
+
+    // Bits run on across rows without padding
+    uint8_t bits = 0;
+    uint32_t bit = 0;
+    for (int16_t y = 0; y < height; y++) {
+      int16_t run = -1;
+      for (int16_t x = 0; x <= width; x++) {
+        bool on = false;
+        if (x < width) {
+          if (!(bit++ & 7))
+            bits = pgm_read_byte(bitmap++);
+          on = bits & 0x80;
+          bits <<= 1;
+        }
+        if (on) {
+          if (run < 0)
+            run = x;
+        } else if (run >= 0) {
+          span(run, y, x - run);
+          run = -1;
+        }
+      }
+    }
+  }
+};
+
+// A GFXcanvas1 layout frame (panel rows of WIDTH bits, MSB first) drawn at a fixed rotation. The frame is not owned,
+// e.g. FrameDisplay::getBuffer(). Every fill is mapped to one panel rect and written a row at a time with masks.
+template <int16_t WIDTH, int16_t HEIGHT, uint8_t R> class FrameRenderer : public Renderer<FrameRenderer<WIDTH, HEIGHT, R>> {
+public:
+  static constexpr uint8_t ROTATION = R & 3;
+  static constexpr int16_t ROW_BYTES = (WIDTH + 7) / 8;
+
+  explicit FrameRenderer(uint8_t *buffer) : buffer(buffer) {}
+
+  static constexpr int16_t width() { return (ROTATION & 1) ? HEIGHT : WIDTH; }
+  static constexpr int16_t height() { return (ROTATION & 1) ? WIDTH : HEIGHT; }
+  uint8_t *getBuffer() const { return buffer; }
+
+  // Maps a rect in screen coordinates to panel coordinates, the same as GFXcanvas1::drawPixel() does per pixel
+  static void toNative(int16_t x, int16_t y, int16_t w, int16_t h, int16_t &nx, int16_t &ny, int16_t &nw, int16_t &nh) {
+    if constexpr (ROTATION == 0) {
+      nx = x;
+      ny = y;
+      nw = w;
+      nh = h;
+    } else if constexpr (ROTATION == 1) {
+      nx = WIDTH - y - h;
+      ny = x;
+      nw = h;
+      nh = w;
+    } else if constexpr (ROTATION == 2) {
+      nx = WIDTH - x - w;
+      ny = HEIGHT - y - h;
+      nw = w;
+      nh = h;
+    } else {
+      nx = y;
+      ny = HEIGHT - x - w;
+      nw = h;
+      nh = w;
+    }
+  }
+
+  // Screen coordinates, negative sizes extend left or up from (x, y) like the Adafruit_GFX line calls
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w < 0) {
+      w = -w;
+      x -= w - 1;
+    }
+    if (h < 0) {
+      h = -h;
+      y -= h - 1;
+    }
+    int16_t nx, ny, nw, nh;
+    toNative(x, y, w, h, nx, ny, nw, nh);
+    fillNative(nx, ny, nw, nh, color);
+  }
+
+  void fillNative(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    if (x + w > WIDTH)
+      w = WIDTH - x;
+    if (y + h > HEIGHT)
+      h = HEIGHT - y;
+    if (w <= 0 || h <= 0)
+      return;
+
+    int16_t first = x >> 3, last = (x + w - 1) >> 3;
+    uint8_t firstMask = 0xFF >> (x & 7);
+    uint8_t lastMask = 0xFF << (7 - ((x + w - 1) & 7));
+    if (first == last)
+      firstMask = lastMask = firstMask & lastMask;
+
+    uint8_t *row = buffer + y * ROW_BYTES;
+    uint8_t fill = color ? 0xFF : 0x00;
+    for (int16_t j = 0; j < h; j++, row += ROW_BYTES) {
+      if (color)
+        row[first] |= firstMask;
+      else
+        row[first] &= ~firstMask;
+      if (last == first)
+        continue;
+      // A row is at most ROW_BYTES, too short for memset() to pay off
+      for (int16_t k = first + 1; k < last; k++)
+        row[k] = fill;
+      if (color)
+        row[last] |= lastMask;
+      else
+        row[last] &= ~lastMask;
+    }
+  }
+
+  // GFXcanvas1::writeSpanMask() at a fixed rotation: the pixels of screen row y from x on whose bit is set in `mask`,
+  // MSB first
+  void writeSpanMask(int16_t x, int16_t y, int16_t w, uint32_t mask, uint16_t color) {
+    if (y < 0 || y >= height() || w <= 0)
+      return;
+    if (x < 0) {
+      if (-x >= w)
+        return;
+      mask <<= -x;
+      w += x;
+      x = 0;
+    }
+    if (x + w > width())
+      w = width() - x;
+    if (w <= 0)
+      return;
+    if (w < 32)
+      mask &= ~(0xFFFFFFFFUL >> w);
+    if (!mask)
+      return;
+
+    if constexpr (!(ROTATION & 1)) {
+      // Along a panel row, mirrored in rotation 2 so that the last pixel of the span comes first
+      int16_t nx = x, ny = y;
+      if constexpr (ROTATION == 2) {
+        nx = WIDTH - x - w;
+        ny = HEIGHT - 1 - y;
+        mask = reverse32(mask) << (32 - w);
+      }
+      // Bit 63 is the MSB of the first panel byte
+      uint64_t bits = (uint64_t)mask << (32 - (nx & 7));
+      uint8_t *ptr = buffer + ny * ROW_BYTES + (nx >> 3);
+      for (int16_t k = 0; k < ((nx & 7) + w + 7) / 8; k++, bits <<= 8) {
+        uint8_t byte = bits >> 56;
+        if (color)
+          ptr[k] |= byte;
+        else
+          ptr[k] &= ~byte;
+      }
+    } else {
+      // Down panel column WIDTH - 1 - y in rotation 1, up column y in rotation 3, one bit per set pixel
+      int16_t nx = (ROTATION == 1) ? WIDTH - 1 - y : y;
+      int16_t ny = (ROTATION == 1) ? x : HEIGHT - 1 - x;
+      constexpr int16_t step = (ROTATION == 1) ? ROW_BYTES : -ROW_BYTES;
+      uint8_t *ptr = buffer + ny * ROW_BYTES + (nx >> 3);
+      uint8_t bit = 0x80 >> (nx & 7);
+      while (mask) {
+        int k = __builtin_clz(mask);
+        mask &= ~(0x80000000UL >> k);
+        if (color)
+          ptr[k * step] |= bit;
+        else
+          ptr[k * step] &= ~bit;
+      }
+    }
+  }
+
+private:
+  uint8_t *buffer;
+
+  static uint32_t reverse32(uint32_t v) {
+    v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
+    v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F) | ((v & 0x0F0F0F0F) << 4);
+    v = ((v >> 8) & 0x00FF00FF) | ((v & 0x00FF00FF) << 8);
+    return (v >> 16) | (v << 16);
+  }
+};
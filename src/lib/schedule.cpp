@@ -0,0 +1,34 @@
+#include "schedule.h"
+
+static uint32_t overhead(const WakeSchedule *schedule) { return schedule->overheadUs != 0 ? schedule->overheadUs : SCHEDULE_OVERHEAD_US; }
+
+uint64_t scheduleSleep(WakeSchedule *schedule, int64_t nowUs) {
+  // The first boundary whose wake is still ahead, skipping one the overhead already ate into would show the old time
+  // for a whole period, so that is caught up on with a short sleep instead
+  int64_t period = UPDATE_WAKEUP_TIMER_US;
+  int64_t boundary = (nowUs / period + 1) * period;
+  int64_t wakeAtUs = boundary + SCHEDULE_MARGIN_US + 2 * (int64_t)schedule->jitterUs - overhead(schedule);
+  if (wakeAtUs < nowUs + SCHEDULE_MIN_SLEEP_US)
+    wakeAtUs = nowUs + SCHEDULE_MIN_SLEEP_US;
+
+  schedule->wakeAtUs = wakeAtUs;
+  return wakeAtUs - nowUs;
+}
+
+void scheduleWake(WakeSchedule *schedule, int64_t nowUs) {
+  if (schedule->wakeAtUs == 0)
+    return;
+  int64_t sample = nowUs - schedule->wakeAtUs;
+  schedule->wakeAtUs = 0;
+  if (sample < 0 || sample > SCHEDULE_MAX_OVERHEAD_US)
+    return;
+
+  // Exponential averages over about 4 wakes follow changes in boot time without jumping on one slow wake
+  if (schedule->overheadUs == 0) {
+    schedule->overheadUs = sample;
+    return;
+  }
+  int32_t error = (int32_t)(sample - schedule->overheadUs);
+  schedule->overheadUs += error / 4;
+  schedule->jitterUs += ((int32_t)abs(error) - (int32_t)schedule->jitterUs) / 4;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Arduino.h"
+
+#include "os_config.h"
+
+// When the minute wake timer was set to fire and how long a wake takes from the timer until it reads the time for
+// drawing, kept across deep sleep. Wakes are scheduled on multiples of UPDATE_WAKEUP_TIMER_US since the epoch, which
+// are minute boundaries in every time zone.
+struct WakeSchedule {
+  int64_t wakeAtUs;    // Epoch us the timer was set to fire at, 0 if the last sleep was not scheduled
+  uint32_t overheadUs; // Smoothed overhead of the last wakes, 0 until one was measured
+  uint32_t jitterUs;   // Smoothed deviation of the overhead from that
+};
+
+// Deep sleep time from `nowUs` (epoch us) so that the next wake reads the time SCHEDULE_MARGIN_US after the next
+// boundary, plus twice the jitter so that a slow wake still reads it after the boundary. Remembers when the wake is due
+// in `schedule`.
+uint64_t scheduleSleep(WakeSchedule *schedule, int64_t nowUs);
+// Measures the overhead of this wake against when it was due, called at `nowUs` right before the time is read for
+// drawing. Wakes that were not scheduled, or that are too far off to be timer wakes (the button, a time sync), are
+// ignored.
+void scheduleWake(WakeSchedule *schedule, int64_t nowUs);
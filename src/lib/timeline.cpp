@@ -0,0 +1,145 @@
+#include "timeline.h"
+
+#include "lib/log.h"
+
+static const char *const phaseNames[] = {"boot", "setup", "handler", "layer", "draw", "refresh", "power down", "loop"};
+static_assert(sizeof(phaseNames) / sizeof(phaseNames[0]) == (size_t)Phase::COUNT, "One name per phase");
+
+static WakeTimeline *current = nullptr;
+static Phase running;
+static uint32_t markUs;
+static uint32_t markCycles;
+
+// The cycle counter can't run faster than 240 MHz, so it can only have wrapped between marks this far apart
+static const uint32_t CYCLE_WRAP_US = UINT32_MAX / 240;
+
+static uint32_t cycleCount() {
+#ifdef ESP32
+  return ESP.getCycleCount();
+#else
+  return 0;
+#endif
+}
+
+static void closePhase(uint32_t nowUs, uint32_t nowCycles) {
+  uint8_t i = (uint8_t)running;
+  uint32_t elapsedUs = nowUs - markUs;
+  current->us[i] += elapsedUs;
+  if (running == Phase::REFRESH) {
+    uint64_t cycles = elapsedUs >= CYCLE_WRAP_US ? UINT32_MAX : (uint64_t)current->refreshCycles + (uint32_t)(nowCycles - markCycles);
+    current->refreshCycles = (uint32_t)min(cycles, (uint64_t)UINT32_MAX);
+  }
+  current->phases |= 1 << i;
+  markUs = nowUs;
+  markCycles = nowCycles;
+}
+
+void timelineBegin(TimelineLog *timelines, uint8_t wakeType) {
+  uint32_t nowUs = micros(), nowCycles = cycleCount();
+
+  if (wakeType >= TIMELINE_WAKE_TYPES) {
+    current = nullptr;
+    return;
+  }
+  TimelineRing &ring = timelines->types[wakeType];
+  current = &ring.wakes[ring.next];
+  memset(current, 0, sizeof(*current));
+  current->sequence = ++timelines->sequence;
+  current->wakeType = wakeType;
+  ring.next = (ring.next + 1) % TIMELINE_WAKES;
+  if (ring.count < TIMELINE_WAKES)
+    ring.count++;
+
+  // micros() counts from the start of the app
+  current->us[(uint8_t)Phase::BOOT] = nowUs;
+  current->phases = 1 << (uint8_t)Phase::BOOT;
+  running = Phase::SETUP;
+  markUs = nowUs;
+  markCycles = nowCycles;
+}
+
+void timelineMark(Phase phase) {
+  if (current == nullptr)
+    return;
+  closePhase(micros(), cycleCount());
+  running = phase;
+}
+
+void timelineEnd() {
+  if (current == nullptr)
+    return;
+  closePhase(micros(), cycleCount());
+  current->complete = true;
+  current = nullptr;
+}
+
+uint8_t timelineOrder(const TimelineLog &timelines, const WakeTimeline *wakes[TIMELINE_WAKE_TYPES * TIMELINE_WAKES]) {
+  // Every ring is in order by itself, merge them by sequence
+  uint8_t count = 0;
+  for (uint8_t type = 0; type < TIMELINE_WAKE_TYPES; type++) {
+    const TimelineRing &ring = timelines.types[type];
+    for (uint8_t n = 0; n < ring.count; n++) {
+      const WakeTimeline *wake = &ring.wakes[(ring.next + TIMELINE_WAKES - ring.count + n) % TIMELINE_WAKES];
+      uint8_t at = count++;
+      for (; at > 0 && wakes[at - 1]->sequence > wake->sequence; at--)
+        wakes[at] = wakes[at - 1];
+      wakes[at] = wake;
+    }
+  }
+  return count;
+}
+
+PhaseStats timelineStats(const TimelineRing &ring, Phase phase) {
+  uint8_t i = (uint8_t)phase;
+  PhaseStats stats = {0, UINT32_MAX, 0, 0, 0};
+  uint64_t totalUs = 0, totalCycles = 0;
+  for (uint8_t n = 0; n < ring.count; n++) {
+    const WakeTimeline &wake = ring.wakes[n];
+    if (!wake.complete || !(wake.phases & (1 << i)))
+      continue;
+    stats.minUs = min(stats.minUs, wake.us[i]);
+    stats.maxUs = max(stats.maxUs, wake.us[i]);
+    totalUs += wake.us[i];
+    if (phase == Phase::REFRESH)
+      totalCycles += wake.refreshCycles;
+    stats.wakes++;
+  }
+  if (stats.wakes == 0)
+    return {};
+  stats.avgUs = (uint32_t)(totalUs / stats.wakes);
+  stats.avgCycles = (uint32_t)(totalCycles / stats.wakes);
+  return stats;
+}
+
+void timelineReport(const TimelineLog &timelines, const char *const wakeNames[], uint8_t wakeTypes) {
+  const WakeTimeline *wakes[TIMELINE_WAKE_TYPES * TIMELINE_WAKES];
+  uint8_t count = timelineOrder(timelines, wakes);
+
+  log(LogLevel::INFO, (String("Wake timelines, last ") + String(TIMELINE_WAKES) + " wakes of every type (us):").c_str());
+  for (uint8_t n = 0; n < count; n++) {
+    const WakeTimeline &wake = *wakes[n];
+    String line = String("#") + String(wake.sequence) + " " + (wake.wakeType < wakeTypes ? wakeNames[wake.wakeType] : "?") + ":";
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < (uint8_t)Phase::COUNT; i++) {
+      if (!(wake.phases & (1 << i)))
+        continue;
+      line += String(" ") + phaseNames[i] + " " + String(wake.us[i]);
+      total += wake.us[i];
+    }
+    line += String(", total ") + String(total) + (wake.complete ? "" : " (incomplete)");
+    log(LogLevel::INFO, line.c_str());
+  }
+
+  for (uint8_t type = 0; type < wakeTypes && type < TIMELINE_WAKE_TYPES; type++) {
+    for (uint8_t i = 0; i < (uint8_t)Phase::COUNT; i++) {
+      PhaseStats stats = timelineStats(timelines.types[type], (Phase)i);
+      if (stats.wakes == 0)
+        continue;
+      String line = String(wakeNames[type]) + " " + phaseNames[i] + ": min " + String(stats.minUs) + " us, avg " + String(stats.avgUs) + " us, max " +
+                    String(stats.maxUs) + " us";
+      if ((Phase)i == Phase::REFRESH)
+        line += String(", avg ") + String(stats.avgCycles / 1000) + " kcycles";
+      log(LogLevel::INFO, (line + " over " + String(stats.wakes) + " wakes").c_str());
+    }
+  }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Arduino.h"
+
+#define TIMELINE_WAKE_TYPES 3 // Wake types with a ring of their own, indexed like the wakeType of timelineBegin()
+#define TIMELINE_WAKES 4      // Wake timelines kept in RTC memory per wake type, the oldest is overwritten
+
+// The stages of a wake, roughly in the order they run. A phase lasts from its mark until the next mark, and a phase
+// marked more than once adds up. BOOT is the time from the start of the app, after the bootloader, until the timeline
+// began.
+enum class Phase : uint8_t { BOOT, SETUP, HANDLER, LAYER, DRAW, REFRESH, POWER_DOWN, LOOP, COUNT };
+
+// Where the time of one wake went. Only the refresh also keeps CPU cycles: it is the one phase the SoC light-sleeps
+// through, the panel's BUSY time, and the cycle counter stops meanwhile, so comparing them with its microseconds shows
+// how much of it the CPU was actually running. The other phases never sleep and would only show the CPU frequency,
+// and leaving them out makes room for more wakes in RTC memory. The counter is 32 bits and wraps every 17.9 s at
+// 240 MHz, so the refresh cycles saturate at UINT32_MAX instead, though a refresh doesn't come close. The host has no
+// cycle counter and records 0.
+struct WakeTimeline {
+  uint32_t sequence;
+  uint8_t wakeType;
+  uint8_t phases; // Bit (1 << Phase) for every phase that ran
+  bool complete;  // False if the wake is still running, or never reached deep sleep
+  uint32_t us[(uint8_t)Phase::COUNT];
+  uint32_t refreshCycles;
+};
+
+// The last TIMELINE_WAKES wakes of one wake type
+struct TimelineRing {
+  uint8_t next;
+  uint8_t count;
+  WakeTimeline wakes[TIMELINE_WAKES];
+};
+
+// A ring per wake type kept across deep sleep, so a run of minute wakes doesn't push out the last full wake
+struct TimelineLog {
+  uint32_t sequence;
+  TimelineRing types[TIMELINE_WAKE_TYPES];
+};
+
+// The min, average and max of one phase over the complete wakes of a ring that ran it
+struct PhaseStats {
+  uint8_t wakes; // 0 if none did, and the rest is 0 too
+  uint32_t minUs;
+  uint32_t avgUs;
+  uint32_t maxUs;
+  uint32_t avgCycles; // Phase::REFRESH only
+};
+
+// Starts this wake's timeline in the next slot of its type's ring, with the time since the app started as BOOT and
+// SETUP running. A wake type past TIMELINE_WAKE_TYPES isn't recorded.
+void timelineBegin(TimelineLog *timelines, uint8_t wakeType);
+// Ends the running phase and starts `phase`. Does nothing before timelineBegin(), e.g. on the host.
+void timelineMark(Phase phase);
+// Ends the running phase and marks the timeline complete, called right before deep sleep
+void timelineEnd();
+// Puts every timeline in `timelines` into `wakes`, oldest first across all types, and returns how many there are
+uint8_t timelineOrder(const TimelineLog &timelines, const WakeTimeline *wakes[TIMELINE_WAKE_TYPES * TIMELINE_WAKES]);
+PhaseStats timelineStats(const TimelineRing &ring, Phase phase);
+// Logs every timeline in `timelines`, oldest first across all types, then the min/avg/max of every phase per wake type. `wakeNames` is
+// indexed by wake type.
+void timelineReport(const TimelineLog &timelines, const char *const wakeNames[], uint8_t wakeTypes);
@@ -1,22 +1,49 @@
 #include "ui.h"
 
-void printLeftString(GxEPD_Class *display, const char *buf, int x, int y) {
-  display->setCursor(x, y);
+static int alignCursor(int x, int16_t width, TextAlign align) {
+  switch (align) {
+  case TextAlign::CENTER:
+    return x - width / 2;
+  case TextAlign::RIGHT:
+    return x - width;
+  default:
+    return x;
+  }
+}
+
+Rect printString(GxEPD_Class *display, const char *buf, int x, int y, TextAlign align, const TextExtent &extent) {
+  int16_t w = textWidth(extent);
+  int16_t h = textHeight(extent);
+  int cursorX = alignCursor(x, w, align);
+  display->setCursor(cursorX, y);
   display->print(buf);
+  if (w == 0 || h == 0) {
+    return {(int16_t)cursorX, (int16_t)y, 0, 0};
+  }
+  return {(int16_t)(cursorX + extent.minX), (int16_t)(y + extent.minY), w, h};
 }
 
-void printRightString(GxEPD_Class *display, const char *buf, int x, int y) {
+Rect printString(GxEPD_Class *display, const char *buf, int x, int y, TextAlign align) {
+  const GFXfont *font = display->getFont();
+  if (font != nullptr) {
+    return printString(display, buf, x, y, align, measureText(fontMetrics(font), buf));
+  }
+
+  // The built-in font has no glyph table, let the display measure it
   int16_t x1, y1;
   uint16_t w, h;
   display->getTextBounds(buf, x, y, &x1, &y1, &w, &h);
-  display->setCursor(x - w, y);
+  int cursorX = alignCursor(x, w, align);
+  display->setCursor(cursorX, y);
   display->print(buf);
+  return {(int16_t)(x1 + cursorX - x), y1, (int16_t)w, (int16_t)h};
 }
 
-void printCenterString(GxEPD_Class *display, const char *buf, int x, int y) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display->getTextBounds(buf, x, y, &x1, &y1, &w, &h);
-  display->setCursor(x - w / 2, y);
+void printLeftString(GxEPD_Class *display, const char *buf, int x, int y) {
+  display->setCursor(x, y);
   display->print(buf);
-}
\ No newline at end of file
+}
+
+Rect printRightString(GxEPD_Class *display, const char *buf, int x, int y) { return printString(display, buf, x, y, TextAlign::RIGHT); }
+
+Rect printCenterString(GxEPD_Class *display, const char *buf, int x, int y) { return printString(display, buf, x, y, TextAlign::CENTER); }
@@ -4,6 +4,17 @@
 #include "GxEPD.h"
 #include <GxDEPG0150BN/GxDEPG0150BN.h> // 1.54" b/w 200x200
 
+#include "lib/fontmetrics.h"
+#include "lib/region.h"
+
+enum class TextAlign { LEFT, CENTER, RIGHT };
+
+// Prints a string already measured with measureText() or TEXT_EXTENT() for the current font, without another pass over
+// the glyphs. Returns the drawn bounds.
+Rect printString(GxEPD_Class *display, const char *buf, int x, int y, TextAlign align, const TextExtent &extent);
+// Measures the string from the glyph table of the current custom font, then prints it
+Rect printString(GxEPD_Class *display, const char *buf, int x, int y, TextAlign align);
+
 void printLeftString(GxEPD_Class *display, const char *buf, int x, int y);
-void printRightString(GxEPD_Class *display, const char *buf, int x, int y);
-void printCenterString(GxEPD_Class *display, const char *buf, int x, int y);
\ No newline at end of file
+Rect printRightString(GxEPD_Class *display, const char *buf, int x, int y);
+Rect printCenterString(GxEPD_Class *display, const char *buf, int x, int y);
@@ -9,6 +9,8 @@
 #include "Preferences.h"
 #include "TinyGPSPlus.h"
 #include "WiFi.h"
+#include "esp_sntp.h"
+#include "esp_timer.h"
 #include "soc/rtc_cntl_reg.h"
 #include "soc/soc.h"
 #include "time.h"
@@ -16,24 +18,40 @@
 #include "apps.h"
 #include "home.h"
 #include "lib/battery.h"
+#include "lib/boot.h"
+#include "lib/display.h"
+#include "lib/drift.h"
+#include "lib/energy.h"
 #include "lib/log.h"
+#include "lib/timeline.h"
 #include "os_config.h"
 #include "wakeup.h"
 
 using namespace ace_button;
 
+// Kept across deep sleep in 7.5 kB of RTC slow memory, which these fill to about 7.3 kB. The frame alone takes 5000 B.
+RTC_DATA_ATTR WakeupFlag wakeup = WakeupFlag::WAKEUP_INIT;
+RTC_DATA_ATTR uint32_t wakeupCount = 0;
+RTC_DATA_ATTR DisplayListState homeList;
+RTC_DATA_ATTR LayerState homeLayer;
+RTC_DATA_ATTR RefreshState refreshState;
+RTC_DATA_ATTR WakeSchedule wakeSchedule;
+RTC_DATA_ATTR DriftState drift;
+RTC_DATA_ATTR EnergyLog energy;
+RTC_DATA_ATTR uint8_t panelFrame[FRAME_BUFFER_SIZE];
+RTC_DATA_ATTR BootTimes bootTimes[3];
+RTC_DATA_ATTR TimelineLog timelines;
+
 GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
-GxEPD_Class display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY);
+FrameDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
 
 ESP32Time rtc;
 TinyGPSPlus gps;
 HardwareSerial gpsPort(Serial2);
 Preferences preferences;
 
-RTC_DATA_ATTR WakeupFlag wakeup = WakeupFlag::WAKEUP_INIT;
-RTC_DATA_ATTR uint32_t wakeupCount = 0;
-
 AwakeState awakeState = AwakeState::APPS_MENU;
+DisplayListState appsList;
 
 uint32_t sleepTimer = 0;
 
@@ -46,28 +64,94 @@ volatile SemaphoreHandle_t timerSemaphore;
 
 void ARDUINO_ISR_ATTR onTimer() { xSemaphoreGiveFromISR(timerSemaphore, NULL); }
 
+// The local clock and esp_timer when the sync was started, esp_timer is not touched by the sync and tells what the local
+// clock would read when it comes in
+static int64_t syncLocalUs, syncTimerUs;
+
+static int64_t localEpochUs() {
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
 void WiFiConnected(WiFiEvent_t event, WiFiEventInfo_t info) {
   log(LogLevel::INFO, "WiFi connected");
+  syncLocalUs = localEpochUs();
+  syncTimerUs = esp_timer_get_time();
   configTime(GMT_OFFSET_SEC, DAY_LIGHT_OFFSET_SEC, NTP_SERVER1);
+}
+
+// A sync as the SNTP task saw it, fitted on the main task by applySync()
+struct TimeSync {
+  int64_t localUs;
+  int64_t syncedUs;
+};
+static QueueHandle_t syncQueue;
+
+// Runs in the SNTP task, so it only hands the times over
+void timeSynced(struct timeval *synced) {
+  TimeSync sync = {syncLocalUs + (esp_timer_get_time() - syncTimerUs), (int64_t)synced->tv_sec * 1000000 + synced->tv_usec};
+  xQueueOverwrite(syncQueue, &sync);
+}
+
+static void applySync() {
+  TimeSync sync;
+  if (syncQueue == NULL || xQueueReceive(syncQueue, &sync, 0) != pdTRUE)
+    return;
+  driftSync(&drift, sync.localUs, sync.syncedUs);
   log(LogLevel::INFO, "Time synchronized from WiFi");
 }
 
-void setup() {
+// Subsystems, started by the boot profile of the wake or on first use
+
+static void startSerial() {
   Serial.begin(115200);
   delay(10);
   log(LogLevel::INFO, "Welcome to qPaperOS!");
   log(LogLevel::SUCCESS, "Serial communication initiliazed");
+}
 
+static void startSPI() {
   // gpsPort.begin(9600, SERIAL_8N1, GPS_RX, GPS_TX);
   // digitalWrite(GPS_RES, OUTPUT);
   // digitalWrite(GPS_RES, LOW);
   SPI.begin(SPI_SCK, -1, SPI_DIN, EPD_CS);
+}
 
-  pinMode(PWR_EN, OUTPUT);
-  pinMode(PIN_MOTOR, OUTPUT);
-  digitalWrite(PWR_EN, HIGH);
-  digitalWrite(PIN_MOTOR, LOW);
-  pinMode(PIN_KEY, INPUT_PULLUP);
+static void startPanel() {
+  display.init();
+  display.setRotation(1);
+  log(LogLevel::SUCCESS, "Display initiliazed");
+}
+
+static void startADC() {
+  pinMode(BAT_ADC, ANALOG);
+  adcAttachPin(BAT_ADC);
+  analogReadResolution(12);
+  analogSetWidth(50);
+}
+
+static void startClock() {
+  // Only the time zone the RTC is read in, the same one configTime() sets. configTime() would bring up the network
+  // stack and SNTP as well, that is left to WiFiConnected().
+  long offset = -GMT_OFFSET_SEC, dst = offset - DAY_LIGHT_OFFSET_SEC;
+  char tz[48];
+  snprintf(tz, sizeof(tz), "UTC%ld:%02ld:%02ldDST%ld:%02ld:%02ld", offset / 3600, labs(offset % 3600) / 60, labs(offset % 60), dst / 3600,
+           labs(dst % 3600) / 60, labs(dst % 60));
+  setenv("TZ", tz, 1);
+  tzset();
+
+  // Take out what the RTC drifted since the last wake, before anything reads the time
+  int64_t localUs = localEpochUs();
+  int32_t correction = driftCorrection(&drift, localUs);
+  if (correction != 0) {
+    localUs += correction;
+    struct timeval corrected = {(time_t)(localUs / 1000000), (suseconds_t)(localUs % 1000000)};
+    settimeofday(&corrected, NULL);
+  }
+}
+
+static void startButton() {
   ButtonConfig *buttonConfig = button.getButtonConfig();
   buttonConfig->setEventHandler(handleButtonEvent);
   buttonConfig->setFeature(ButtonConfig::kFeatureClick);
@@ -76,48 +160,107 @@ void setup() {
   buttonConfig->setClickDelay(200);
   buttonConfig->setDebounceDelay(10);
   buttonConfig->setLongPressDelay(1000);
+  xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, NULL);
+}
 
-  pinMode(BAT_ADC, ANALOG);
-  adcAttachPin(BAT_ADC);
-  analogReadResolution(12);
-  analogSetWidth(50);
-  log(LogLevel::SUCCESS, "Hardware pins initiliazed");
-
-  WiFi.onEvent(WiFiConnected, WiFiEvent_t::ARDUINO_EVENT_WIFI_STA_CONNECTED);
-
+static void startUITimer() {
   timerSemaphore = xSemaphoreCreateBinary();
   uiTimer = timerBegin(0, 80, true);
   timerAttachInterrupt(uiTimer, &onTimer, true);
   timerAlarmWrite(uiTimer, 1000000, true);
   timerAlarmEnable(uiTimer);
   log(LogLevel::SUCCESS, "Hardware timer initiliazed");
+}
 
+static void startWiFi() {
+  syncQueue = xQueueCreate(1, sizeof(TimeSync));
+  WiFi.onEvent(WiFiConnected, WiFiEvent_t::ARDUINO_EVENT_WIFI_STA_CONNECTED);
+  sntp_set_time_sync_notification_cb(timeSynced);
+}
+
+static void startPreferences() {
   preferences.begin(PREFS_KEY);
   log(LogLevel::SUCCESS, "Preferences initiliazed");
+}
 
-  configTime(GMT_OFFSET_SEC, DAY_LIGHT_OFFSET_SEC, nullptr);
-  log(LogLevel::SUCCESS, "Time configured");
+// In Subsystem order
+static const SubsystemSetup subsystems[] = {
+    {"serial", startSerial, 0},
+    {"spi", startSPI, 0},
+    {"panel", startPanel, SUBSYSTEM_BIT(SPI_BUS)},
+    {"adc", startADC, 0},
+    {"clock", startClock, 0},
+    {"button", startButton, 0},
+    {"timer", startUITimer, 0},
+    {"wifi", startWiFi, 0},
+    {"preferences", startPreferences, 0},
+};
+static_assert(sizeof(subsystems) / sizeof(subsystems[0]) == (size_t)Subsystem::COUNT, "One setup per subsystem");
+
+#define BOOT_LIGHT_SERIAL (BOOT_LOG_LIGHT_WAKES ? SUBSYSTEM_BIT(SERIAL_LOG) : 0)
+
+// What each wake type starts before its handler runs, in WakeupFlag order. The minute tick only needs the panel, the
+// time zone and the battery reading.
+static const BootProfile bootProfiles[] = {
+    {"init", SUBSYSTEM_BIT(SERIAL_LOG) | SUBSYSTEM_BIT(SPI_BUS) | SUBSYSTEM_BIT(PANEL) | SUBSYSTEM_BIT(CLOCK) | SUBSYSTEM_BIT(UI_TIMER) |
+                 SUBSYSTEM_BIT(PREFERENCES)},
+    {"full", SUBSYSTEM_BIT(SERIAL_LOG) | SUBSYSTEM_BIT(SPI_BUS) | SUBSYSTEM_BIT(PANEL) | SUBSYSTEM_BIT(CLOCK) | SUBSYSTEM_BIT(BUTTON) |
+                 SUBSYSTEM_BIT(UI_TIMER) | SUBSYSTEM_BIT(PREFERENCES)},
+    {"light", BOOT_LIGHT_SERIAL | SUBSYSTEM_BIT(SPI_BUS) | SUBSYSTEM_BIT(PANEL) | SUBSYSTEM_BIT(ADC) | SUBSYSTEM_BIT(CLOCK)},
+};
+
+static const char *const wakeNames[] = {"init", "full", "light"};
+static_assert(sizeof(wakeNames) / sizeof(wakeNames[0]) == ENERGY_WAKE_TYPES, "One name per wake type");
+static_assert(sizeof(wakeNames) / sizeof(wakeNames[0]) == TIMELINE_WAKE_TYPES, "One timeline ring per wake type");
+
+// Today's energy from RTC memory with the past days from flash
+static void reportEnergy() {
+  bootRequire(Subsystem::PREFERENCES);
+  EnergyDay days[ENERGY_DAYS] = {};
+  preferences.getBytes("energy_days", days, sizeof(days));
+  energyReport(energy, days, wakeNames);
+}
 
-  display.init();
-  display.setRotation(1);
-  log(LogLevel::SUCCESS, "Display initiliazed");
+void setup() {
+  // Power and the button pin are needed by every wake, the key decides which wake this is
+  pinMode(PWR_EN, OUTPUT);
+  pinMode(PIN_MOTOR, OUTPUT);
+  digitalWrite(PWR_EN, HIGH);
+  digitalWrite(PIN_MOTOR, LOW);
+  pinMode(PIN_KEY, INPUT_PULLUP);
 
   if (digitalRead(PIN_KEY) == 0)
     wakeup = WakeupFlag::WAKEUP_FULL;
+  timelineBegin(&timelines, (uint8_t)wakeup);
+  energyBegin(&energy, (uint8_t)wakeup, localEpochUs());
+
+  const BootProfile &profile = bootProfiles[(uint8_t)wakeup];
+  bootBegin(subsystems);
+  bootProfile(profile);
+  bootDone(profile, &bootTimes[(uint8_t)wakeup]);
+  if (wakeup == WakeupFlag::WAKEUP_FULL) {
+    bootReport(bootProfiles, bootTimes, sizeof(bootProfiles) / sizeof(bootProfiles[0]));
+    timelineReport(timelines, wakeNames, sizeof(wakeNames) / sizeof(wakeNames[0]));
+    reportEnergy();
+  }
   log(LogLevel::INFO, "Starting wakeup process...");
+  timelineMark(Phase::HANDLER);
+
+  // Init and full wakes don't sleep on the schedule, so the light wake after them has nothing to measure against
+  if (wakeup != WakeupFlag::WAKEUP_LIGHT)
+    wakeSchedule.wakeAtUs = 0;
 
   switch (wakeup) {
   case WakeupFlag::WAKEUP_INIT:
-    wakeupInit(&wakeup, &wakeupCount, &display, &rtc, &preferences);
+    wakeupInit(&wakeup, &wakeupCount, &homeList, &homeLayer, &refreshState, &display, &rtc, &preferences);
     break;
 
   case WakeupFlag::WAKEUP_LIGHT:
-    wakeupLight(&wakeup, &wakeupCount, &display, &rtc, &preferences);
+    wakeupLight(&wakeup, &wakeupCount, &homeList, &homeLayer, &refreshState, &wakeSchedule, &drift, &energy, &display, &rtc, &preferences);
     break;
 
   case WakeupFlag::WAKEUP_FULL:
-    xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, NULL);
-    wakeupFull(&wakeup, &wakeupCount, &display, &rtc, &preferences);
+    wakeupFull(&wakeup, &wakeupCount, &homeList, &energy, &display, &rtc, &preferences);
     break;
   }
 
@@ -125,6 +268,20 @@ void setup() {
 }
 
 void loop() {
+  timelineMark(Phase::LOOP);
+  applySync();
+  // Light wakes only stay up to sync the time over WiFi
+  bootRequire(Subsystem::UI_TIMER);
+
+  // "timeline" and "energy" on the serial console dump those reports again
+  if (bootStarted(Subsystem::SERIAL_LOG) && Serial.available()) {
+    String command = Serial.readStringUntil('\n');
+    command.trim();
+    if (command == "timeline")
+      timelineReport(timelines, wakeNames, sizeof(wakeNames) / sizeof(wakeNames[0]));
+    else if (command == "energy")
+      reportEnergy();
+  }
   if (xSemaphoreTake(timerSemaphore, 0) == pdTRUE && awakeState != AwakeState::IN_APP)
     sleepTimer++;
 
@@ -134,11 +291,11 @@ void loop() {
     break;
 
   case WakeupFlag::WAKEUP_LIGHT:
-    wakeupLightLoop(&wakeup, sleepTimer, &display, &rtc);
+    wakeupLightLoop(&wakeup, sleepTimer, &wakeSchedule, &drift, &display, &rtc);
     break;
 
   case WakeupFlag::WAKEUP_FULL:
-    wakeupFullLoop(&wakeup, sleepTimer, &display, &rtc, awakeState);
+    wakeupFullLoop(&wakeup, sleepTimer, &appsList, &refreshState, &display, &rtc, awakeState);
     break;
   }
 }
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <string>
+
+#include "ESP32Time.h"
+#include "GxIO/GxIO_SPI/GxIO_SPI.h"
+
+#include "apps.h"
+#include "home.h"
+#include "lib/battery.h"
+#include "lib/display.h"
+#include "os_config.h"
+
+// `pio test -e native` builds src/ along with the tests, which bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+// Host entry point of [env:native]. Draws every screen on the virtual panel, dumps what the panel shows afterwards as a
+// PBM into the directory given as the first argument, and prints the SPI traffic and refreshes each screen took. Built with
+// GFX_PROFILE ([env:profile]) it also prints the draw calls of each screen and saves its overdraw heatmap.
+
+uint8_t panelFrame[FRAME_BUFFER_SIZE];
+
+GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
+FrameDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
+
+ESP32Time rtc;
+
+static std::string outputDir = ".";
+
+#ifdef GFX_PROFILE
+static GFXprofiler profiler(GxEPD_WIDTH, GxEPD_HEIGHT);
+#endif
+
+static void beginScreen() {
+#ifdef GFX_PROFILE
+  profiler.beginFrame();
+#endif
+}
+
+static void dumpScreen(const std::string &name) {
+  const GxEPD_Class::Stats &stats = display.stats();
+  printf("%-16s %6u SPI bytes, %u full + %u partial refreshes, %6u px refreshed\n", name.c_str(), stats.spiBytes, stats.fullRefreshes,
+         stats.partialRefreshes, stats.refreshedPixels);
+
+  std::string path = outputDir + "/" + name + ".pbm";
+  if (!display.writePBM(path.c_str()))
+    fprintf(stderr, "Could not write %s\n", path.c_str());
+  display.resetStats();
+
+#ifdef GFX_PROFILE
+  profiler.printTable(Serial);
+  printf("\n");
+  path = outputDir + "/" + name + "_overdraw.ppm";
+  if (!profiler.writeHeatmap(path.c_str(), display.getRotation()))
+    fprintf(stderr, "Could not write %s\n", path.c_str());
+#endif
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1)
+    outputDir = argv[1];
+
+  // A fixed time, so that every run draws the same frames
+  rtc.setTime(0, 34, 12, 3, 6, 2024);
+  display.init();
+  display.setRotation(1);
+  initApps();
+#ifdef GFX_PROFILE
+  display.setProfiler(&profiler);
+#endif
+
+  beginScreen();
+  display.fillScreen(GxEPD_WHITE);
+  drawHomeBackground(&display);
+  drawHomeUI(&display, &rtc, calculateBatteryStatus());
+  display.update();
+  dumpScreen("home");
+
+  for (currentAppIndex = 0; currentAppIndex < apps.size(); currentAppIndex++) {
+    std::string index = std::to_string(currentAppIndex);
+    beginScreen();
+    drawAppsListUI(&display, &rtc, calculateBatteryStatus());
+    display.updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
+    dumpScreen("apps_" + index);
+
+    beginScreen();
+    apps[currentAppIndex]->setup();
+    apps[currentAppIndex]->drawUI(&display);
+    apps[currentAppIndex]->exit();
+    dumpScreen("app_" + index);
+  }
+  return 0;
+}
+
+#endif
@@ -30,4 +30,37 @@
 #define DAY_LIGHT_OFFSET_SEC   0
 
 // Software Functions Configuration
-#define UPDATE_WAKEUP_TIMER_US 60 * 1000000
\ No newline at end of file
+#define UPDATE_WAKEUP_TIMER_US 60 * 1000000
+#define BOOT_LOG_LIGHT_WAKES   false  // Start Serial on the minute wake too, which costs its boot time a few ms
+#define TIME_SAVE_WAKES        5      // Minute wakes between saving the time to flash, for the next cold boot to start from
+
+// Wake Schedule Configuration
+#define SCHEDULE_OVERHEAD_US     250000  // Time from the wake timer until the time is read for drawing, until measured
+#define SCHEDULE_MAX_OVERHEAD_US 5000000 // Wakes further off than this from when they were due are not timer wakes
+#define SCHEDULE_MARGIN_US       20000   // How long after the minute boundary the time is read
+#define SCHEDULE_MIN_SLEEP_US    50000   // Shortest scheduled sleep, when the next boundary is already too close
+
+// Time Sync and Drift Configuration
+#define TIME_SYNC_WAKES        30  // Minute wakes between time syncs over WiFi
+#define TIME_SYNC_FITTED_WAKES 240 // Minute wakes between time syncs once the RTC drift is fitted
+#define DRIFT_SAMPLES          8   // Syncs the drift is fitted over
+#define DRIFT_MIN_SAMPLES      3   // Syncs needed before the fit is trusted to sync less often
+#define DRIFT_MIN_SPAN_S       600 // Shortest time between syncs to take a drift sample from, shorter ones are mostly sync noise
+#define DRIFT_MAX_PPM          500 // Larger gains are not drift, e.g. the clock was set in between
+
+// Energy Model Configuration, what the whole board draws in each state. Estimates until measured on a watch.
+#define ENERGY_CPU_240_UA      50000  // Awake at 240 MHz
+#define ENERGY_CPU_80_UA       25000  // Awake at 80 MHz
+#define ENERGY_LIGHT_SLEEP_UA  1500   // Light sleep through the panel's BUSY time
+#define ENERGY_PANEL_UA        4000   // On top of the CPU while the panel refreshes
+#define ENERGY_WIFI_UA         90000  // On top of the CPU while the radio is up
+#define ENERGY_DEEP_SLEEP_UA   1000   // Deep sleep, with the panel and the regulator quiescent current
+#define ENERGY_BATTERY_MAH     250
+
+// Refresh Policy Configuration
+#define REFRESH_MAX_PARTIALS   30     // Partial refreshes allowed before a full refresh is forced
+#define REFRESH_MAX_AREA       40000  // Changed pixels allowed across partial refreshes before a full refresh is forced
+#define REFRESH_FULL_ON_HOUR   true   // Force a full refresh at the top of every hour
+#define REFRESH_WINDOW_US      2000   // Fixed updateWindow() overhead, until calibrated from measured refreshes
+#define REFRESH_BYTE_NS        6000   // updateWindow() time per byte of window, until calibrated
+#define REFRESH_BUSY_US        300000 // Partial refresh waveform time, until calibrated
@@ -1,179 +1,86 @@
 #pragma once
 
-#include "Arduino.h"
+// Generated by tools/assetconvert.py, do not edit. Regenerate with:
+// python3 tools/assetconvert.py --rotate 1 --rle -o src/resources/app_icons.h assets/icons/apps/*.png
 
-// Use https://javl.github.io/image2cpp/
-// with inverted color and black background
+#include "lib/asset.h"
 
-// ----- APP ICONS -----
+const uint8_t icon_app_about_data[] PROGMEM = {
+    0xff, 0xff, 0xff, 0x4e, 0x0e, 0x52, 0x16, 0x4b, 0x1c, 0x45, 0x22, 0x40, 0x26, 0x3c, 0x2a, 0x38,
+    0x2d, 0x36, 0x30, 0x33, 0x13, 0x0c, 0x13, 0x30, 0x11, 0x14, 0x10, 0x2e, 0x0f, 0x1a, 0x0f, 0x2b,
+    0x0e, 0x1e, 0x0e, 0x29, 0x0d, 0x22, 0x0d, 0x27, 0x0c, 0x25, 0x0d, 0x25, 0x0c, 0x28, 0x0c, 0x23,
+    0x0c, 0x2a, 0x0c, 0x22, 0x0a, 0x2d, 0x0b, 0x21, 0x0a, 0x2f, 0x0b, 0x1f, 0x0a, 0x31, 0x0b, 0x1d,
+    0x0a, 0x33, 0x0a, 0x1d, 0x0a, 0x34, 0x0a, 0x1b, 0x0a, 0x36, 0x0a, 0x1a, 0x09, 0x38, 0x09, 0x19,
+    0x09, 0x3a, 0x09, 0x18, 0x09, 0x3a, 0x09, 0x17, 0x09, 0x3c, 0x09, 0x16, 0x09, 0x3c, 0x09, 0x16,
+    0x08, 0x3e, 0x08, 0x15, 0x09, 0x3e, 0x09, 0x14, 0x08, 0x40, 0x08, 0x14, 0x08, 0x40, 0x08, 0x13,
+    0x09, 0x40, 0x09, 0x12, 0x08, 0x0d, 0x02, 0x33, 0x08, 0x12, 0x08, 0x0b, 0x06, 0x31, 0x08, 0x12,
+    0x08, 0x0a, 0x07, 0x31, 0x08, 0x11, 0x09, 0x0a, 0x08, 0x15, 0x03, 0x18, 0x09, 0x10, 0x08, 0x0b,
+    0x08, 0x14, 0x05, 0x18, 0x08, 0x10, 0x08, 0x0b, 0x08, 0x13, 0x07, 0x07, 0x03, 0x0d, 0x08, 0x10,
+    0x08, 0x0b, 0x08, 0x13, 0x08, 0x05, 0x06, 0x0b, 0x08, 0x10, 0x08, 0x0b, 0x23, 0x04, 0x08, 0x0a,
+    0x08, 0x10, 0x08, 0x0b, 0x23, 0x03, 0x09, 0x0a, 0x08, 0x10, 0x08, 0x0b, 0x23, 0x03, 0x0a, 0x09,
+    0x08, 0x10, 0x08, 0x0b, 0x23, 0x03, 0x0a, 0x09, 0x08, 0x10, 0x08, 0x0b, 0x23, 0x03, 0x09, 0x0a,
+    0x08, 0x10, 0x08, 0x0b, 0x22, 0x05, 0x08, 0x0a, 0x08, 0x10, 0x08, 0x0b, 0x22, 0x06, 0x06, 0x0b,
+    0x08, 0x10, 0x08, 0x0b, 0x21, 0x08, 0x04, 0x0c, 0x08, 0x10, 0x08, 0x0b, 0x08, 0x31, 0x08, 0x10,
+    0x09, 0x0a, 0x08, 0x30, 0x09, 0x11, 0x08, 0x0a, 0x08, 0x30, 0x08, 0x12, 0x08, 0x0a, 0x08, 0x30,
+    0x08, 0x12, 0x08, 0x0a, 0x07, 0x31, 0x08, 0x12, 0x09, 0x0a, 0x06, 0x30, 0x09, 0x13, 0x08, 0x0c,
+    0x02, 0x32, 0x08, 0x14, 0x08, 0x40, 0x08, 0x14, 0x09, 0x3e, 0x09, 0x15, 0x08, 0x3e, 0x08, 0x16,
+    0x09, 0x3c, 0x09, 0x16, 0x09, 0x3c, 0x09, 0x17, 0x09, 0x3a, 0x09, 0x18, 0x09, 0x39, 0x0a, 0x19,
+    0x09, 0x38, 0x09, 0x1a, 0x0a, 0x36, 0x0a, 0x1b, 0x0a, 0x34, 0x0a, 0x1c, 0x0a, 0x33, 0x0a, 0x1e,
+    0x0a, 0x31, 0x0b, 0x1f, 0x0a, 0x2f, 0x0b, 0x21, 0x0a, 0x2d, 0x0b, 0x22, 0x0c, 0x2a, 0x0b, 0x24,
+    0x0c, 0x28, 0x0c, 0x25, 0x0c, 0x26, 0x0c, 0x27, 0x0d, 0x22, 0x0d, 0x29, 0x0e, 0x1e, 0x0e, 0x2b,
+    0x0f, 0x1a, 0x0f, 0x2d, 0x11, 0x14, 0x11, 0x30, 0x13, 0x0c, 0x13, 0x33, 0x30, 0x35, 0x2e, 0x38,
+    0x2a, 0x3c, 0x26, 0x40, 0x22, 0x45, 0x1c, 0x4b, 0x16, 0x52, 0x0e, 0xff, 0xff, 0xff, 0x4e};
+const Asset icon_app_about = {icon_app_about_data, 100, 100, AssetEncoding::RLE, true, 1};
 
-const unsigned char icon_app_gps_connect[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x07, 0xff,
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00,
-    0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80,
-    0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x07, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x01, 0xff, 0xff, 0xf8,
-    0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x03, 0xff,
-    0xff, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0,
-    0x07, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03,
-    0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x00,
-    0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff,
-    0x80, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00,
-    0x1f, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x0f, 0xff, 0xff,
-    0xff, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x07,
-    0xff, 0xff, 0xfe, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f,
-    0xc0, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x01, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x1f, 0xe0, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x07, 0xfe, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0x80, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x1f, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf8, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
-    0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00};
+const uint8_t icon_app_gps_connect_data[] PROGMEM = {
+    0xff, 0xff, 0xff, 0xff, 0x80, 0x04, 0x5f, 0x06, 0x5e, 0x06, 0x5d, 0x08, 0x5c, 0x08, 0x5c, 0x08,
+    0x5c, 0x08, 0x5a, 0x0c, 0x54, 0x14, 0x4d, 0x1a, 0x48, 0x1e, 0x44, 0x22, 0x41, 0x24, 0x3e, 0x27,
+    0x3c, 0x10, 0x0a, 0x10, 0x39, 0x0e, 0x11, 0x0d, 0x37, 0x0c, 0x16, 0x0c, 0x35, 0x0b, 0x1a, 0x0b,
+    0x33, 0x0b, 0x1c, 0x0b, 0x31, 0x0a, 0x20, 0x0a, 0x30, 0x09, 0x22, 0x09, 0x2f, 0x09, 0x24, 0x09,
+    0x2d, 0x09, 0x26, 0x09, 0x2c, 0x08, 0x28, 0x08, 0x2b, 0x09, 0x28, 0x09, 0x2a, 0x08, 0x10, 0x0a,
+    0x10, 0x08, 0x29, 0x08, 0x0f, 0x0e, 0x0f, 0x08, 0x28, 0x08, 0x0e, 0x10, 0x0e, 0x08, 0x28, 0x07,
+    0x0d, 0x14, 0x0d, 0x07, 0x27, 0x08, 0x0c, 0x16, 0x0c, 0x08, 0x26, 0x07, 0x0c, 0x17, 0x0c, 0x08,
+    0x26, 0x07, 0x0c, 0x18, 0x0c, 0x07, 0x26, 0x07, 0x0b, 0x1a, 0x0b, 0x07, 0x25, 0x08, 0x0b, 0x1a,
+    0x0b, 0x08, 0x24, 0x07, 0x0b, 0x1c, 0x0b, 0x07, 0x20, 0x0b, 0x0b, 0x1c, 0x0b, 0x0b, 0x1a, 0x0d,
+    0x0b, 0x1c, 0x0b, 0x0d, 0x17, 0x0e, 0x0b, 0x1c, 0x0b, 0x0e, 0x16, 0x0e, 0x0b, 0x1c, 0x0b, 0x0e,
+    0x16, 0x0e, 0x0b, 0x1c, 0x0b, 0x0e, 0x16, 0x0e, 0x0b, 0x1c, 0x0b, 0x0e, 0x17, 0x0d, 0x0b, 0x1c,
+    0x0b, 0x0d, 0x1a, 0x0b, 0x0b, 0x1c, 0x0b, 0x0b, 0x20, 0x07, 0x0b, 0x1c, 0x0b, 0x07, 0x24, 0x08,
+    0x0b, 0x1a, 0x0b, 0x08, 0x25, 0x07, 0x0b, 0x1a, 0x0b, 0x07, 0x26, 0x07, 0x0c, 0x18, 0x0c, 0x07,
+    0x26, 0x07, 0x0d, 0x16, 0x0d, 0x07, 0x26, 0x08, 0x0c, 0x16, 0x0c, 0x08, 0x27, 0x07, 0x0d, 0x14,
+    0x0d, 0x07, 0x28, 0x08, 0x0d, 0x11, 0x0e, 0x08, 0x28, 0x08, 0x0f, 0x0e, 0x0f, 0x08, 0x29, 0x08,
+    0x10, 0x0a, 0x10, 0x08, 0x2a, 0x09, 0x28, 0x09, 0x2b, 0x08, 0x28, 0x08, 0x2c, 0x09, 0x26, 0x09,
+    0x2d, 0x09, 0x24, 0x09, 0x2f, 0x09, 0x22, 0x09, 0x30, 0x0a, 0x20, 0x09, 0x32, 0x0b, 0x1c, 0x0b,
+    0x33, 0x0b, 0x1a, 0x0b, 0x35, 0x0c, 0x16, 0x0c, 0x37, 0x0d, 0x11, 0x0e, 0x39, 0x10, 0x0a, 0x10,
+    0x3b, 0x28, 0x3e, 0x24, 0x41, 0x22, 0x44, 0x1e, 0x48, 0x1a, 0x4d, 0x14, 0x54, 0x0c, 0x5a, 0x08,
+    0x5c, 0x08, 0x5c, 0x08, 0x5c, 0x08, 0x5d, 0x06, 0x5e, 0x06, 0x5f, 0x04, 0xff, 0xff, 0xff, 0xff,
+    0x80};
+const Asset icon_app_gps_connect = {icon_app_gps_connect_data, 100, 100, AssetEncoding::RLE, true, 1};
 
-const unsigned char icon_app_wifi_smartconfig[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xfe,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,
-    0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8,
-    0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00,
-    0x0f, 0xfc, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-    0xc0, 0x00, 0x03, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xf0, 0x00, 0x03, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
-    0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe0,
-    0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xfe, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xf8, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_app_about[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0xff,
-    0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00,
-    0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-    0x80, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-    0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,
-    0x00, 0x00, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x7f, 0xf0,
-    0x00, 0x00, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0x03, 0xfc, 0x00, 0x00,
-    0x1f, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x07, 0xfe,
-    0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00,
-    0x07, 0xfe, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xf0,
-    0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00,
-    0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0,
-    0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00,
-    0x3f, 0xc0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x0f, 0xfe, 0x00,
-    0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x1f,
-    0xfe, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00,
-    0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff,
-    0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00,
-    0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f,
-    0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00,
-    0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe,
-    0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
-    0x01, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x7f, 0x80,
-    0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00,
-    0x7f, 0x80, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x3f, 0xe0,
-    0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00,
-    0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x01, 0xfe, 0x00,
-    0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0x7f,
-    0xff, 0xf8, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00,
-    0x00, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x07,
-    0xfe, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0x0f, 0xfc, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80,
-    0x00, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0xff, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00};
+const uint8_t icon_app_wifi_smartconfig_data[] PROGMEM = {
+    0xff, 0xff, 0x95, 0x04, 0x5f, 0x06, 0x5d, 0x08, 0x5c, 0x09, 0x5b, 0x0a, 0x5a, 0x0b, 0x5a, 0x0b,
+    0x5a, 0x0b, 0x5a, 0x0a, 0x5b, 0x0a, 0x5b, 0x0a, 0x5b, 0x0a, 0x47, 0x04, 0x0f, 0x0a, 0x46, 0x06,
+    0x0f, 0x0a, 0x45, 0x07, 0x0f, 0x09, 0x44, 0x09, 0x0f, 0x09, 0x43, 0x0a, 0x0e, 0x09, 0x43, 0x0b,
+    0x0e, 0x09, 0x43, 0x0b, 0x0d, 0x09, 0x44, 0x0b, 0x0d, 0x09, 0x44, 0x0a, 0x0e, 0x08, 0x45, 0x0a,
+    0x0d, 0x09, 0x45, 0x0a, 0x0d, 0x08, 0x46, 0x09, 0x0d, 0x09, 0x33, 0x04, 0x0e, 0x0a, 0x0c, 0x09,
+    0x32, 0x06, 0x0e, 0x09, 0x0d, 0x08, 0x31, 0x08, 0x0e, 0x09, 0x0c, 0x09, 0x30, 0x09, 0x0d, 0x09,
+    0x0d, 0x08, 0x30, 0x0a, 0x0d, 0x09, 0x0c, 0x08, 0x30, 0x0b, 0x0c, 0x09, 0x0c, 0x09, 0x30, 0x0a,
+    0x0d, 0x09, 0x0c, 0x08, 0x31, 0x0a, 0x0c, 0x09, 0x0c, 0x08, 0x32, 0x09, 0x0d, 0x08, 0x0c, 0x08,
+    0x33, 0x09, 0x0c, 0x08, 0x0c, 0x09, 0x32, 0x09, 0x0c, 0x09, 0x0c, 0x08, 0x33, 0x09, 0x0c, 0x08,
+    0x0c, 0x08, 0x33, 0x09, 0x0c, 0x08, 0x0c, 0x08, 0x34, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x34, 0x09,
+    0x0b, 0x09, 0x0b, 0x08, 0x24, 0x05, 0x0c, 0x08, 0x0c, 0x08, 0x0b, 0x08, 0x23, 0x07, 0x0b, 0x08,
+    0x0c, 0x08, 0x0b, 0x08, 0x22, 0x09, 0x0a, 0x08, 0x0c, 0x08, 0x0b, 0x08, 0x22, 0x0a, 0x09, 0x08,
+    0x0c, 0x08, 0x0b, 0x09, 0x20, 0x0b, 0x09, 0x08, 0x0c, 0x08, 0x0b, 0x09, 0x20, 0x0b, 0x09, 0x08,
+    0x0c, 0x08, 0x0b, 0x09, 0x20, 0x0b, 0x09, 0x08, 0x0c, 0x08, 0x0b, 0x09, 0x21, 0x09, 0x0a, 0x08,
+    0x0c, 0x08, 0x0b, 0x08, 0x23, 0x07, 0x0b, 0x08, 0x0c, 0x08, 0x0b, 0x08, 0x24, 0x05, 0x0c, 0x08,
+    0x0c, 0x08, 0x0b, 0x08, 0x34, 0x09, 0x0b, 0x09, 0x0b, 0x08, 0x34, 0x08, 0x0c, 0x08, 0x0c, 0x08,
+    0x33, 0x09, 0x0c, 0x08, 0x0c, 0x08, 0x33, 0x09, 0x0c, 0x08, 0x0c, 0x08, 0x32, 0x09, 0x0c, 0x09,
+    0x0c, 0x08, 0x32, 0x09, 0x0c, 0x08, 0x0c, 0x09, 0x31, 0x09, 0x0d, 0x08, 0x0c, 0x08, 0x31, 0x0a,
+    0x0c, 0x09, 0x0c, 0x08, 0x30, 0x0a, 0x0d, 0x09, 0x0c, 0x08, 0x2f, 0x0b, 0x0c, 0x09, 0x0c, 0x09,
+    0x2f, 0x0a, 0x0d, 0x09, 0x0c, 0x08, 0x30, 0x09, 0x0d, 0x09, 0x0d, 0x08, 0x30, 0x08, 0x0e, 0x09,
+    0x0c, 0x09, 0x31, 0x06, 0x0e, 0x09, 0x0d, 0x08, 0x33, 0x04, 0x0e, 0x0a, 0x0d, 0x08, 0x45, 0x09,
+    0x0d, 0x09, 0x44, 0x0a, 0x0d, 0x08, 0x44, 0x0a, 0x0d, 0x09, 0x43, 0x0a, 0x0e, 0x09, 0x42, 0x0b,
+    0x0d, 0x09, 0x42, 0x0b, 0x0d, 0x0a, 0x42, 0x0a, 0x0e, 0x09, 0x42, 0x0a, 0x0e, 0x0a, 0x42, 0x09,
+    0x0f, 0x09, 0x43, 0x08, 0x0f, 0x09, 0x45, 0x06, 0x0f, 0x0a, 0x46, 0x04, 0x0f, 0x0a, 0x5a, 0x0a,
+    0x59, 0x0a, 0x59, 0x0a, 0x59, 0x0a, 0x59, 0x0b, 0x58, 0x0b, 0x58, 0x0b, 0x59, 0x0a, 0x5a, 0x09,
+    0x5b, 0x08, 0x5d, 0x06, 0x5f, 0x04, 0xff, 0xff, 0x7f};
+const Asset icon_app_wifi_smartconfig = {icon_app_wifi_smartconfig_data, 100, 100, AssetEncoding::RLE, true, 1};
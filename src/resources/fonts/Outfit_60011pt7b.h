@@ -1,5 +1,7 @@
 #pragma once
 
+#include "lib/fontmetrics.h"
+
 const uint8_t Outfit_60011pt7bBitmaps[] PROGMEM = {
     0x00, 0xEE, 0xE6, 0x66, 0x66, 0x66, 0x60, 0x0E, 0xFE, 0xEF, 0xCF, 0x9B, 0x36, 0x6C, 0xC0, 0x0C, 0xE1, 0xCC, 0x1C, 0xC1, 0x8C, 0x7F, 0xF7, 0xFF,
     0x19, 0xC3, 0x98, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x18, 0x33, 0x87, 0x38, 0x73, 0x00, 0x06, 0x00, 0xC0, 0x7E, 0x3F, 0xE7, 0x7C, 0xED, 0x1D, 0x83,
@@ -70,7 +72,7 @@ const uint8_t Outfit_60011pt7bBitmaps[] PROGMEM = {
     0xF0, 0xFF, 0xFF, 0x0E, 0x7C, 0xF9, 0x83, 0x06, 0x0C, 0x18, 0xF1, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x3E, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xC3, 0xCF, 0x0C, 0x30, 0xC3, 0x0C, 0x3C, 0x73, 0x0C, 0x30, 0xC3, 0x0C, 0xF3, 0x80, 0x7C, 0xBF, 0xF4, 0xF8};
 
-const GFXglyph Outfit_60011pt7bGlyphs[] PROGMEM = {{0, 1, 1, 4, 0, 0},         // 0x20 ' '
+constexpr GFXglyph Outfit_60011pt7bGlyphs[] PROGMEM = {{0, 1, 1, 4, 0, 0},         // 0x20 ' '
                                                    {1, 4, 16, 6, 1, -15},      // 0x21 '!'
                                                    {9, 7, 6, 10, 1, -15},      // 0x22 '"'
                                                    {15, 12, 15, 14, 1, -14},   // 0x23 '#'
@@ -168,4 +170,6 @@ const GFXglyph Outfit_60011pt7bGlyphs[] PROGMEM = {{0, 1, 1, 4, 0, 0},         /
 
 const GFXfont Outfit_60011pt7b PROGMEM = {(uint8_t *)Outfit_60011pt7bBitmaps, (GFXglyph *)Outfit_60011pt7bGlyphs, 0x20, 0x7E, 27};
 
+constexpr FontMetrics Outfit_60011pt7bMetrics = {Outfit_60011pt7bGlyphs, 0x20, 0x7E};
+
 // Approx. 2298 bytes
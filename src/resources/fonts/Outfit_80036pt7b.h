@@ -1,1674 +1,122 @@
 #pragma once
 
+#include "lib/fontmetrics.h"
+
+// Subset: 0123456789:
+
 const uint8_t Outfit_80036pt7bBitmaps[] PROGMEM = {
-    0x00, 0x7F, 0xFD, 0xFF, 0xF7, 0xFF, 0xDF, 0xFF, 0x7F, 0xFD, 0xFF, 0xF7,
-    0xFF, 0xDF, 0xFF, 0x7F, 0xFD, 0xFF, 0xE7, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8,
-    0xFF, 0xE3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x8F, 0xFE,
-    0x3F, 0xF8, 0xFF, 0xE3, 0xFF, 0x8F, 0xFE, 0x3F, 0xF8, 0xFF, 0xC3, 0xFF,
-    0x07, 0xFC, 0x1F, 0xF0, 0x7F, 0xC1, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0xFC, 0x3F,
-    0xF9, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF,
-    0xFF, 0x7F, 0xF8, 0xFF, 0xE1, 0xFF, 0x01, 0xE0, 0xFF, 0xF1, 0xFF, 0xEF,
-    0xFE, 0x1F, 0xFD, 0xFF, 0xC3, 0xFF, 0xBF, 0xF0, 0x7F, 0xE7, 0xFE, 0x0F,
-    0xFC, 0xFF, 0xC1, 0xFF, 0x9F, 0xF8, 0x3F, 0xF3, 0xFF, 0x07, 0xFE, 0x7F,
-    0xE0, 0xFF, 0xCF, 0xFC, 0x1F, 0xF9, 0xFF, 0x83, 0xFF, 0x1F, 0xF0, 0x3F,
-    0xE3, 0xFE, 0x07, 0xFC, 0x7F, 0x80, 0xFF, 0x0F, 0xF0, 0x1F, 0xE1, 0xFE,
-    0x03, 0xFC, 0x3F, 0xC0, 0x7F, 0x87, 0xF8, 0x0F, 0xF0, 0xFF, 0x01, 0xFE,
-    0x1F, 0xE0, 0x3F, 0xC3, 0xFC, 0x07, 0xF8, 0x7F, 0x80, 0xFF, 0x00, 0x00,
-    0x07, 0xFE, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF0, 0x1F, 0xF0, 0x00, 0x07, 0xFE, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x03, 0xFE, 0x03, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00,
-    0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x0F,
-    0xFC, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF8,
-    0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xC0, 0x7F,
-    0xE0, 0x00, 0x1F, 0xF8, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x03, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
-    0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x1F, 0xF8, 0x0F,
-    0xFC, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x7F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x81, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x3F, 0xF0, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x01, 0xFF,
-    0x81, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00,
-    0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xF9, 0xF8, 0x07, 0xFF,
-    0xBF, 0xE3, 0xC0, 0x1F, 0xFE, 0xFF, 0x82, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xF0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
-    0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0xFF, 0xF0,
-    0x10, 0x0F, 0xFB, 0xFF, 0xC0, 0xE0, 0x3F, 0xEF, 0xFF, 0x07, 0xE0, 0xFF,
-    0xBF, 0xFC, 0x3F, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0,
-    0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-    0xF0, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xF0,
-    0x1F, 0xFF, 0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F,
-    0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0xFF, 0xCF, 0xF8, 0x1F, 0xFC, 0x07, 0xFC,
-    0x3F, 0xC0, 0xFF, 0xE0, 0x3F, 0xC1, 0xFE, 0x0F, 0xFE, 0x01, 0xFE, 0x0F,
-    0xF0, 0x7F, 0xE0, 0x0F, 0xF8, 0x7F, 0x87, 0xFF, 0x00, 0x7F, 0xFF, 0xFC,
-    0x7F, 0xF0, 0x01, 0xFF, 0xFF, 0xE3, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, 0x3F,
-    0xF8, 0x00, 0x3F, 0xFF, 0xF1, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x1F, 0xFC,
-    0x00, 0x07, 0xFF, 0xF0, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x0F, 0xFE, 0x00,
-    0x00, 0x3F, 0xE0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xC0, 0x00, 0x07, 0xFF, 0x0F,
-    0xFF, 0x80, 0x00, 0x3F, 0xF8, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0x8F, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFC, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xC7, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xE3, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xFE, 0x1F, 0xE1, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0x07, 0xF8, 0x07,
-    0xFF, 0x07, 0xF8, 0x3F, 0xC0, 0x3F, 0xF8, 0x3F, 0xC1, 0xFE, 0x03, 0xFF,
-    0x81, 0xFF, 0xBF, 0xF0, 0x3F, 0xF8, 0x0F, 0xFF, 0xFF, 0x81, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xF8, 0x1F, 0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x07,
-    0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x7F,
-    0xFC, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0,
-    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x07, 0x00, 0x00, 0x00,
-    0xFF, 0xE0, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xF8, 0xFF,
-    0xFE, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0xFF,
-    0xFE, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0xFF,
-    0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF,
-    0xFC, 0x00, 0x3F, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x1F, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF1, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x01, 0xFF,
-    0xF8, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x7F, 0xE7,
-    0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
-    0xFE, 0x7F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3, 0xFC, 0x3F, 0xC3,
-    0xFC, 0x3F, 0xC3, 0xFC, 0x00, 0x08, 0x00, 0x01, 0x80, 0x00, 0x78, 0x00,
-    0x1F, 0x80, 0x07, 0xF8, 0x01, 0xFF, 0x80, 0x7F, 0xF8, 0x0F, 0xFF, 0x03,
-    0xFF, 0xC0, 0xFF, 0xF0, 0x1F, 0xFE, 0x07, 0xFF, 0x80, 0xFF, 0xE0, 0x3F,
-    0xFC, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0xFF,
-    0xC0, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF8,
-    0x07, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x3F, 0xF8,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x1F, 0xFC,
-    0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFF,
-    0x00, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF,
-    0x00, 0x3F, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0x00, 0x02, 0x00,
-    0x00, 0xE0, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x03, 0xFC, 0x00, 0xFF, 0xC0,
-    0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x7F, 0xF8, 0x07, 0xFF, 0x80, 0x7F, 0xF0,
-    0x0F, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xE0, 0x1F, 0xFC,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC,
-    0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
-    0x07, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0xFF, 0xE0,
-    0x1F, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x00,
-    0xFF, 0xE0, 0x1F, 0xFC, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x07,
-    0xFF, 0x01, 0xFF, 0xE0, 0x3F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0xFF,
-    0xF0, 0x0F, 0xFE, 0x00, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x0E,
-    0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x01, 0xC0, 0x00,
-    0x18, 0x0F, 0xC0, 0x00, 0xF0, 0x3F, 0xC0, 0x07, 0xC0, 0xFF, 0xC0, 0x3F,
-    0x83, 0xFE, 0x01, 0xFF, 0x1F, 0xF0, 0x0F, 0xFC, 0x7F, 0x80, 0x3F, 0xF9,
-    0xFE, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFE,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xC0, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xF9, 0xFE, 0x7F, 0xF7, 0xE1, 0xF8, 0xFF,
-    0x1F, 0x80, 0xE3, 0xF8, 0x7F, 0x00, 0x07, 0xC1, 0xFC, 0x00, 0x1C, 0x07,
-    0xF0, 0x00, 0x20, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFE,
-    0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x40, 0x00,
-    0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,
-    0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0F, 0xE0, 0xFF, 0xC3, 0xFF, 0x9F,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7,
-    0xFF, 0xCF, 0xFE, 0x1F, 0xF8, 0x1F, 0xC0, 0xFF, 0x03, 0xF8, 0x1F, 0xE0,
-    0x7F, 0x03, 0xFC, 0x0F, 0xE0, 0x7F, 0x81, 0xFC, 0x03, 0xE0, 0x03, 0x80,
-    0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xC0,
-    0xFF, 0xC7, 0xFF, 0xBF, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x9F, 0xFC, 0x1F, 0xE0, 0x1E, 0x00, 0x00,
-    0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF,
-    0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00,
-    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x03,
-    0xFF, 0x80, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80,
-    0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F,
-    0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00,
-    0x0F, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE,
-    0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x01,
-    0xFF, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0,
-    0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F,
-    0xF8, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF,
-    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00,
-    0xFF, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0,
-    0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x81, 0xFF, 0xF8, 0x03, 0xFF,
-    0xF8, 0x7F, 0xFE, 0x00, 0x3F, 0xFF, 0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xE3,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x7F, 0xFC, 0x00, 0x07, 0xFF, 0xCF, 0xFF,
-    0x80, 0x00, 0x7F, 0xF9, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xEF, 0xFF, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x3F,
-    0xFE, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x7F, 0xFC,
-    0x00, 0x1F, 0xFF, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0xFF, 0xFC, 0x01,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
-    0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
-    0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
-    0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F,
-    0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
-    0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00,
-    0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF,
-    0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x0F,
-    0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0x81, 0xFF, 0xFC, 0x1F, 0xF8,
-    0x03, 0xFF, 0xF0, 0x3F, 0xC0, 0x07, 0xFF, 0xC0, 0x7E, 0x00, 0x0F, 0xFF,
-    0x00, 0xF0, 0x00, 0x3F, 0xFC, 0x01, 0x80, 0x00, 0xFF, 0xF8, 0x02, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x10, 0x00, 0x0F, 0xFF, 0x81, 0xC0, 0x00, 0xFF, 0xFC,
-    0x1F, 0x80, 0x0F, 0xFF, 0xE1, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F,
-    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x0F, 0xFF, 0x00,
-    0x1F, 0xFF, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x03, 0xFF, 0xC0, 0x0F, 0xFF,
-    0x81, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x7F,
-    0xF8, 0x07, 0xFF, 0xE0, 0x3F, 0xFC, 0x03, 0xFF, 0xE0, 0x1F, 0xFE, 0x03,
-    0xFF, 0xF0, 0x0F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
-    0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF8,
-    0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x10, 0x00, 0x0F, 0xFF, 0x81, 0xC0, 0x00, 0xFF,
-    0xFC, 0x1F, 0x00, 0x0F, 0xFF, 0xC1, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF0, 0x1F, 0xFF, 0x9F, 0xFF, 0x80,
-    0x3F, 0xFE, 0x7F, 0xFC, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0xFF, 0xF7,
-    0xFF, 0x80, 0x03, 0xFF, 0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xF7, 0xFF, 0x80, 0x03, 0xFF, 0xDF,
-    0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x7F, 0xFD, 0xFF, 0xF0, 0x01,
-    0xFF, 0xF7, 0xFF, 0xE0, 0x0F, 0xFF, 0xCF, 0xFF, 0xC0, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF,
-    0x80, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00,
-    0x0F, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-    0x80, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x83,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0x9F, 0xFF, 0xC3, 0xFF, 0xE0, 0x7F,
-    0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xC3, 0xFF, 0x80, 0x1F, 0xFC, 0x3F, 0xF8,
-    0x01, 0xFF, 0xC3, 0xFF, 0x80, 0x1F, 0xFC, 0x3F, 0xF8, 0x01, 0xFF, 0xC3,
-    0xFF, 0xC0, 0x1F, 0xFC, 0x3F, 0xFC, 0x03, 0xFF, 0xC1, 0xFF, 0xE0, 0x7F,
-    0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF0, 0xFF, 0xFC, 0x7F, 0xFC,
-    0x03, 0xFF, 0xE7, 0xFF, 0x80, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x80,
-    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xC0, 0xFF, 0xFE, 0x7F, 0xFE,
-    0x00, 0xFF, 0xFD, 0xFF, 0xF0, 0x01, 0xFF, 0xF7, 0xFF, 0x80, 0x07, 0xFF,
-    0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
-    0x7F, 0xF8, 0x00, 0x3F, 0xFD, 0xFF, 0xE0, 0x00, 0xFF, 0xF7, 0xFF, 0xC0,
-    0x07, 0xFF, 0xDF, 0xFF, 0x80, 0x3F, 0xFE, 0x3F, 0xFF, 0x01, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF,
-    0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x07, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFC,
-    0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFF, 0x87, 0xFF, 0x1F, 0xFE, 0xFF,
-    0xFB, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0x9F,
-    0xFC, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x1F, 0xFC, 0xFF, 0xFB,
-    0xFF, 0xEF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x9F, 0xFE,
-    0x7F, 0xF0, 0xFF, 0x80, 0x78, 0x00, 0x07, 0xC0, 0x7F, 0x83, 0xFF, 0x9F,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
-    0xFF, 0x9F, 0xFE, 0x3F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x83, 0xFF, 0x0F, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xDF, 0xFF, 0x3F, 0xF8, 0x7F, 0xE0, 0x7F, 0x03, 0xFC, 0x0F, 0xE0, 0x7F,
-    0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x81, 0xFC, 0x0F, 0xF0, 0x0F, 0x80, 0x0E,
-    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-    0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x03,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF,
-    0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-    0x00, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x60,
-    0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-    0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFE, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x1F, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF,
-    0xFF, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF,
-    0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x7F,
-    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x7F, 0xFF,
-    0x0F, 0xF0, 0x1F, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0x03, 0x80, 0x0F, 0xFF,
-    0x01, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-    0x00, 0x07, 0xF8, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x07,
-    0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00,
-    0x3F, 0xF8, 0x1F, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x1F, 0xF8, 0x00, 0x00,
-    0x0F, 0xFC, 0x3F, 0xF0, 0x07, 0xC0, 0x07, 0xFE, 0x3F, 0xE0, 0x3F, 0xFF,
-    0xE3, 0xFE, 0x7F, 0xE0, 0x7F, 0xFF, 0xE3, 0xFE, 0x7F, 0xC0, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0xE0, 0xFF, 0xFF, 0x87, 0xF8, 0x3F, 0xE0, 0xFF, 0xFF, 0x87, 0xF0, 0x3F,
-    0xE0, 0xFF, 0xFF, 0x87, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0x07, 0xF0, 0x1F,
-    0xE0, 0xFF, 0xFF, 0x87, 0xF0, 0x1F, 0xE0, 0xFF, 0xFF, 0x87, 0xF8, 0x3F,
-    0xE0, 0xFF, 0xFF, 0x87, 0xFC, 0x7F, 0xE0, 0xFF, 0xFF, 0x87, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x7F, 0xC1, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x7F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xF0, 0x0F, 0xCF,
-    0xFF, 0xFC, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x20, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xF0, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE7,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x7F, 0xF0, 0x00, 0x00, 0x07, 0xFF,
-    0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFC, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0x80, 0x00,
-    0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0x00,
-    0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
-    0x00, 0x01, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7F,
-    0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0,
-    0x7F, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
-    0x83, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0x1F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0x00,
-    0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0x00,
-    0x00, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFC, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00,
-    0xFF, 0xF8, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xF8, 0x00,
-    0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x00, 0x1F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0xFF,
-    0xF8, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF7, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xF8, 0x00, 0xFF, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xF8, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0x00, 0x3F, 0xFF, 0x00,
-    0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x04, 0x00, 0x7F, 0xFF,
-    0x00, 0x00, 0x38, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0xF0, 0x03, 0xFF, 0xFE,
-    0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0xFF, 0xDF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0,
-    0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF8,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC,
-    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFC,
-    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFC,
-    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
-    0x80, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0xF8, 0x00,
-    0x00, 0x3C, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0x80, 0x07, 0xFF, 0xE0,
-    0x00, 0x00, 0x10, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xFF, 0xF7, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0x7F,
-    0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xE7, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFE,
-    0x7F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xFE, 0x3F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC1, 0xFF, 0xFC, 0x00, 0x00,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
-    0x07, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC,
-    0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFC, 0x00,
-    0x00, 0x1F, 0xFF, 0x01, 0x00, 0x07, 0xFF, 0xC0, 0xE0, 0x03, 0xFF, 0xE0,
-    0x7E, 0x01, 0xFF, 0xF8, 0x3F, 0xF7, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0x0F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF,
-    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0x80, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFB, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xCF, 0xFF, 0x80, 0x00, 0xFF, 0xFE,
-    0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xC3,
-    0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x3F,
-    0xFE, 0x00, 0x3F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0x03, 0xFF,
-    0xE0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFE,
-    0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xE0,
-    0x3F, 0xFF, 0x80, 0x0F, 0xFF, 0x81, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x0F,
-    0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xFF, 0x00, 0x03, 0xFF, 0xE1, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x7F, 0xFF,
-    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xEF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xFE, 0x00, 0x00,
-    0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0x87, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x1F, 0xFF, 0xC0, 0x00, 0xFF,
-    0xF8, 0x3F, 0xFF, 0x80, 0x03, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x0F, 0xFF,
-    0x80, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x03, 0xFF, 0xF8, 0x00, 0xFF, 0xF8,
-    0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0x80,
-    0x3F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xF8, 0x00,
-    0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x07,
-    0xFF, 0xF0, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x8F, 0xFF, 0x80, 0x00, 0xFF,
-    0xFE, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xFB, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF,
-    0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,
-    0x07, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07,
-    0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xC0,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xF0, 0x0F, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x0F, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0x0F, 0xFF, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0x8F, 0xFF, 0x8F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xEF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF,
-    0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF,
-    0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0x1F,
-    0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xE0, 0x00,
-    0x00, 0xFF, 0xFC, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFF, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0xFF,
-    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
-    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
-    0xFF, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xE3, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x0F, 0xFF,
-    0xC0, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x01,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xF8, 0x00,
-    0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x1F, 0xFE,
-    0xFF, 0xF8, 0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x1F,
-    0xFE, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0xFF,
-    0xF8, 0x00, 0xFF, 0xFE, 0xFF, 0xF8, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x3F, 0xFF, 0x00,
-    0x00, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x7F,
-    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x7F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0xFF, 0xF8, 0x00, 0x01, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x01, 0x80,
-    0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x03, 0xC0, 0xFF, 0xF8, 0xFF, 0xF8, 0x00,
-    0x07, 0xE0, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x0F, 0xF0, 0xFF, 0xF8, 0xFF,
-    0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0xFF,
-    0xF8, 0x7F, 0xFC, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x3F,
-    0xFF, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xF0,
-    0x3F, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x01, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x80, 0x07,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xC0, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFE, 0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0xC3, 0xFF,
-    0xE0, 0x01, 0xFF, 0xF0, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x00,
-    0x0F, 0xFF, 0x8F, 0xFF, 0x80, 0x03, 0xFF, 0xE3, 0xFF, 0xE0, 0x00, 0xFF,
-    0xF8, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0x8F,
-    0xFF, 0x80, 0x07, 0xFF, 0xC3, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0xE0,
-    0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x3F, 0xFE, 0x3F, 0xFF, 0x00, 0x0F,
-    0xFF, 0x87, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0xFF, 0xF8,
-    0x3F, 0xFF, 0x00, 0x3F, 0xFE, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0xFF,
-    0xFC, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
-    0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x83, 0xFF,
-    0xE0, 0x07, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00,
-    0x3F, 0xFF, 0x8F, 0xFF, 0x80, 0x07, 0xFF, 0xF3, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFC, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xBF, 0xFE, 0x00, 0x07, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFC, 0x01, 0xFF, 0x01, 0xFF,
-    0xF0, 0x00, 0xFC, 0x03, 0xFF, 0xE0, 0x00, 0xF0, 0x07, 0xFF, 0xC0, 0x00,
-    0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x01,
-    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F,
-    0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE,
-    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00,
-    0x01, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x10, 0x00, 0x01, 0xFF,
-    0xE0, 0x70, 0x00, 0x03, 0xFF, 0xC1, 0xF8, 0x00, 0x0F, 0xFF, 0x87, 0xF8,
-    0x00, 0x1F, 0xFF, 0x1F, 0xFC, 0x00, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF8,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x80, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-    0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFF, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x9F, 0xFF, 0x80,
-    0x07, 0xFF, 0xE7, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF,
-    0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00,
-    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xCF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE7,
-    0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0,
-    0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF8, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF8,
-    0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xFC,
-    0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF,
-    0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFF,
-    0x80, 0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF,
-    0xC0, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xE0, 0x01, 0xFF, 0xF0, 0x01, 0xFF,
-    0xE0, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0xFF,
-    0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x7F,
-    0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x1F,
-    0xFE, 0x00, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x0F,
-    0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xC7,
-    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFB,
-    0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE,
-    0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF,
-    0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xE7,
-    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0x9F, 0xFE, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00,
-    0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC3, 0xFF,
-    0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x0F, 0xFF, 0x80, 0x07, 0xFF,
-    0xF0, 0x00, 0x7F, 0xF8, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x01, 0xFF,
-    0xE0, 0x7F, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF, 0x01, 0xFF, 0xF0,
-    0x01, 0xFF, 0xFE, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0xF8,
-    0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xC0,
-    0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xC0, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x07,
-    0xFF, 0xFF, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x03,
-    0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x7F, 0xFF, 0xF8, 0x0F, 0xFF, 0x00, 0x1F,
-    0xFF, 0x01, 0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x0F, 0xFF,
-    0xFF, 0x80, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0xFE, 0x07, 0xFF,
-    0x80, 0x03, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x07, 0xFF,
-    0x87, 0xFF, 0x7F, 0xF0, 0x7F, 0xF8, 0x00, 0x1F, 0xFE, 0x1F, 0xFD, 0xFF,
-    0xC3, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x7F, 0xF3, 0xFF, 0x8F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF3, 0xFF, 0x8F, 0xFE, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xCF,
-    0xFE, 0x3F, 0xF8, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x3F, 0xF8, 0x7F, 0xF7,
-    0xFF, 0x80, 0x00, 0x1F, 0xFE, 0xFF, 0xE1, 0xFF, 0xDF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0x07, 0xFF, 0x7F, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
-    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F,
-    0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x03, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-    0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-    0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x01, 0xFF, 0xFC,
-    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00,
-    0x3F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,
-    0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF,
-    0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0x80, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x0F, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xC0, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFE, 0x07, 0xFF,
-    0xE0, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC3, 0xFF,
-    0xF0, 0x00, 0x07, 0xFF, 0xF3, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF9, 0xFF,
-    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-    0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xDF, 0xFF, 0x80, 0x00, 0x07,
-    0xFF, 0xC7, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE3, 0xFF, 0xF0, 0x00, 0x07,
-    0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFF, 0x00, 0x03,
-    0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01,
-    0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x01,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xC0,
-    0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8,
-    0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-    0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-    0xFE, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF9, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-    0xF1, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC3, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0x83, 0xFF, 0xF0, 0x00, 0x7F, 0xFE, 0x07, 0xFF, 0xF0, 0x01, 0xFF, 0xF8,
-    0x07, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x00,
-    0x1F, 0xFF, 0xC0, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x83, 0xFF, 0xF0, 0x00,
-    0x1F, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x1F, 0xFF, 0x80, 0x00,
-    0x3F, 0xFF, 0x7F, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00,
-    0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
-    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03,
-    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-    0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-    0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-    0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0,
-    0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
-    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
-    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03,
-    0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80,
-    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
-    0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01,
-    0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
-    0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07,
-    0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F,
-    0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F,
-    0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F,
-    0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF,
-    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF,
-    0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00,
-    0x07, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-    0x80, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-    0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF,
-    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00,
-    0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00,
-    0x3F, 0xF0, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC,
-    0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
-    0x7F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x1F, 0xF8,
-    0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00,
-    0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-    0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0x80, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x7F, 0xE0,
-    0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x3F, 0xF8, 0x00, 0x03,
-    0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xC0,
-    0x00, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F,
-    0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF,
-    0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF,
-    0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF,
-    0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE,
-    0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC,
-    0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8,
-    0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0,
-    0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xE0,
-    0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x3F, 0xEF, 0xF8, 0x01, 0xFF, 0x3F,
-    0xC0, 0x1F, 0xF1, 0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x0F, 0xF8, 0x3F, 0xE0,
-    0x7F, 0xC0, 0xFF, 0x87, 0xFC, 0x07, 0xFC, 0x3F, 0xE0, 0x1F, 0xF3, 0xFE,
-    0x00, 0xFF, 0xBF, 0xF0, 0x03, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x06,
-    0x00, 0x01, 0xC0, 0x00, 0xF8, 0x00, 0x7F, 0x00, 0x1F, 0xF0, 0x0F, 0xFE,
-    0x03, 0xFF, 0xC1, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 0xFF, 0xF1, 0xFF, 0xFC,
-    0x1F, 0xFE, 0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x00, 0xE0, 0x00, 0x08, 0x00,
-    0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xFF, 0xF0, 0x0F, 0xFF, 0xFB,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE0, 0x7F, 0xFF, 0x7F, 0xFE, 0x00, 0xFF,
-    0xFD, 0xFF, 0xF0, 0x01, 0xFF, 0xF7, 0xFF, 0xC0, 0x03, 0xFF, 0xDF, 0xFE,
-    0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xF8,
-    0x00, 0x3F, 0xFD, 0xFF, 0xF0, 0x01, 0xFF, 0xF7, 0xFF, 0xE0, 0x07, 0xFF,
-    0xDF, 0xFF, 0xC0, 0x3F, 0xFF, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFE, 0xFF, 0xF0, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0xF8,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE,
-    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F,
-    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0x80, 0x07, 0xFF, 0xBF, 0xFF,
-    0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFC, 0x0F, 0xFF, 0xEF,
-    0xFF, 0x80, 0x3F, 0xFF, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF,
-    0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF,
-    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0xFF, 0xFF, 0x0F, 0xFF, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-    0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-    0x1F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFC,
-    0x0F, 0xFF, 0xE0, 0x1C, 0x07, 0xFF, 0xE0, 0x04, 0x03, 0xFF, 0xE0, 0x00,
-    0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x00,
-    0x00, 0x0F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xF0,
-    0x01, 0x00, 0xFF, 0xFE, 0x01, 0xC0, 0x7F, 0xFF, 0xC3, 0xF0, 0x1F, 0xFF,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF,
-    0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFE, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-    0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F,
-    0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x0F, 0xFC, 0x3F, 0xFC, 0x00, 0xFF, 0xFE, 0xFF, 0xF0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE0, 0x7F, 0xFF, 0x7F, 0xFE, 0x00,
-    0xFF, 0xFD, 0xFF, 0xF0, 0x01, 0xFF, 0xF7, 0xFF, 0xC0, 0x03, 0xFF, 0xDF,
-    0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00,
-    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0x7F,
-    0xF8, 0x00, 0x3F, 0xFD, 0xFF, 0xF0, 0x01, 0xFF, 0xF7, 0xFF, 0xE0, 0x07,
-    0xFF, 0xDF, 0xFF, 0xC0, 0x3F, 0xFF, 0x3F, 0xFF, 0xC3, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFE, 0xFF, 0xF0, 0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x00,
-    0x78, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-    0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xF0, 0x0F,
-    0xFF, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0xFF, 0xF0, 0x00, 0xFF, 0xE7, 0xFF,
-    0x80, 0x07, 0xFF, 0x3F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x18, 0x01, 0xFF,
-    0xF0, 0x01, 0xE0, 0x0F, 0xFF, 0xE0, 0x7F, 0x80, 0x3F, 0xFF, 0xFF, 0xFE,
-    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
-    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFC,
-    0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
-    0x0F, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFE,
-    0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xF8, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x08, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x01,
-    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00,
-    0x7F, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x00, 0x1F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8,
-    0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xC0,
-    0x3F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0xF3, 0xFF, 0xFE, 0xFF, 0xFC, 0x03, 0xFF, 0xF7, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x03,
-    0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xF7, 0xFF,
-    0xC0, 0x0F, 0xFF, 0xBF, 0xFF, 0x00, 0xFF, 0xFD, 0xFF, 0xFC, 0x0F, 0xFF,
-    0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x7F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x7F, 0xF8, 0x00,
-    0x3F, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
-    0xF0, 0x10, 0x00, 0x0F, 0xFF, 0x81, 0xC0, 0x00, 0xFF, 0xF8, 0x1F, 0x80,
-    0x0F, 0xFF, 0xC1, 0xFF, 0x01, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xE1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F,
-    0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0x80, 0x3F, 0xFC,
-    0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x06,
-    0x00, 0xFE, 0x0F, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xDF, 0xFC, 0x7F, 0xC1, 0xFC, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF7, 0xFF, 0xBF, 0xFD, 0xFF,
-    0xEF, 0xFF, 0x7F, 0xFB, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0xFF, 0xBF, 0xFD,
-    0xFF, 0xEF, 0xFF, 0x7F, 0xFB, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0xFF, 0xBF,
-    0xFD, 0xFF, 0xEF, 0xFF, 0x7F, 0xFB, 0xFF, 0xDF, 0xFE, 0xFF, 0xF7, 0xFF,
-    0xBF, 0xFD, 0xFF, 0xEF, 0xFF, 0x7F, 0xFB, 0xFF, 0xDF, 0xFE, 0xFF, 0xF0,
-    0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x0F,
-    0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x00,
-    0x1F, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xF8,
-    0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0,
-    0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF,
-    0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x00,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-    0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF,
-    0x00, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFC, 0x04,
-    0x1F, 0xFF, 0x03, 0x8F, 0xFF, 0x81, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8,
-    0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0x7F,
-    0xF8, 0x00, 0x01, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x00,
-    0x7F, 0xFC, 0xFF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF, 0x00, 0xFF, 0xF8, 0xFF,
-    0xF0, 0x1F, 0xFF, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xF0, 0x3F, 0xFE,
-    0x0F, 0xFF, 0x07, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0x0F, 0xFF, 0x0F,
-    0xFF, 0x80, 0xFF, 0xF1, 0xFF, 0xF0, 0x0F, 0xFF, 0x3F, 0xFE, 0x00, 0xFF,
-    0xF3, 0xFF, 0xC0, 0x0F, 0xFF, 0x7F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF,
-    0xF7, 0xFF, 0xC0, 0x0F, 0xFF, 0x3F, 0xFE, 0x00, 0xFF, 0xF3, 0xFF, 0xE0,
-    0x0F, 0xFF, 0x1F, 0xFF, 0x00, 0xFF, 0xF1, 0xFF, 0xF8, 0x0F, 0xFF, 0x0F,
-    0xFF, 0x80, 0xFF, 0xF0, 0x7F, 0xFC, 0x0F, 0xFF, 0x07, 0xFF, 0xE0, 0xFF,
-    0xF0, 0x3F, 0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0xF0, 0xFF, 0xF0, 0x1F, 0xFF,
-    0x8F, 0xFF, 0x00, 0xFF, 0xF8, 0xFF, 0xF0, 0x0F, 0xFF, 0xCF, 0xFF, 0x00,
-    0x7F, 0xFE, 0xFF, 0xF0, 0x07, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x00, 0xFF, 0x80, 0x0F, 0xFC, 0x01, 0xFF, 0xE7, 0xFF, 0xC0, 0x7F,
-    0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF,
-    0xEF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0x03, 0xFF, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFC, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
-    0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xE0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F,
-    0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF,
-    0x80, 0x3F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x01, 0xFF,
-    0xFF, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xF0,
-    0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07,
-    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-    0xC0, 0x1F, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x7F,
-    0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF,
-    0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0xFF,
-    0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x3F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFC, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00,
-    0x3F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3,
-    0xFF, 0xF8, 0x0F, 0xFF, 0xE7, 0xFF, 0xE0, 0x0F, 0xFF, 0xCF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xBF, 0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xFC, 0x00, 0x1F, 0xFF,
-    0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0,
-    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xEF, 0xFF, 0x80, 0x0F, 0xFF, 0x9F, 0xFF, 0x00, 0x1F, 0xFF, 0x3F, 0xFF,
-    0x00, 0x7F, 0xFE, 0x3F, 0xFF, 0x83, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
-    0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
-    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xF0,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x07, 0xFF, 0xBF, 0xFF, 0x80, 0x3F,
-    0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFC, 0x0F, 0xFF, 0xEF, 0xFF, 0x80,
-    0x3F, 0xFF, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
-    0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
-    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF,
-    0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0xFF, 0xFF, 0x0F, 0xFF, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF,
-    0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x7C, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF,
-    0xC0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
-    0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xFC, 0xFF, 0xF0, 0x0F, 0xFF, 0xFB, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF,
-    0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0xE0, 0x7F, 0xFF, 0x7F, 0xFE, 0x00, 0xFF, 0xFD, 0xFF, 0xF0, 0x01, 0xFF,
-    0xF7, 0xFF, 0xC0, 0x03, 0xFF, 0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xF8,
-    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF,
-    0xDF, 0xFE, 0x00, 0x0F, 0xFF, 0x7F, 0xF8, 0x00, 0x3F, 0xFD, 0xFF, 0xF0,
-    0x01, 0xFF, 0xF7, 0xFF, 0xE0, 0x07, 0xFF, 0xDF, 0xFF, 0xC0, 0x3F, 0xFF,
-    0x7F, 0xFF, 0xC7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-    0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0xFF, 0xF0,
-    0x01, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x00,
-    0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0,
-    0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x03,
-    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0x8F, 0xFF, 0x3F, 0xFE, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x80, 0xFF, 0xF8,
-    0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-    0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00,
-    0x00, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F,
-    0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x1F, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x1F,
-    0xFF, 0x07, 0xF0, 0x1F, 0xFE, 0x01, 0xE0, 0x1F, 0xFE, 0x00, 0x40, 0x1F,
-    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x0F,
-    0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x03,
-    0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x03, 0x00, 0x1F, 0xFE, 0x07,
-    0x80, 0x1F, 0xFE, 0x0F, 0xE0, 0x1F, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF0, 0x03,
-    0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFC, 0x00, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-    0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
-    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x01,
-    0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF8,
-    0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x0F,
-    0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xC0,
-    0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x7F,
-    0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x07,
-    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00,
-    0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0,
-    0x1F, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8,
-    0x03, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
-    0xE0, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF,
-    0xFC, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
-    0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
-    0x87, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF,
-    0xC0, 0x3F, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xC0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0xF8,
-    0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0xFF, 0xF9, 0xFF, 0xF0, 0x01, 0xFF,
-    0xF1, 0xFF, 0xE0, 0x03, 0xFF, 0xC3, 0xFF, 0xE0, 0x0F, 0xFF, 0x87, 0xFF,
-    0xC0, 0x1F, 0xFE, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x0F, 0xFF, 0x80, 0xFF,
-    0xF8, 0x0F, 0xFF, 0x01, 0xFF, 0xE0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x3F,
-    0xFC, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x1F, 0xFE, 0x00, 0x7F, 0xF8, 0x3F,
-    0xFC, 0x00, 0x7F, 0xF0, 0x7F, 0xF0, 0x00, 0xFF, 0xF1, 0xFF, 0xE0, 0x01,
-    0xFF, 0xE3, 0xFF, 0x80, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0xDF,
-    0xFE, 0x00, 0x03, 0xFF, 0xBF, 0xF8, 0x00, 0x07, 0xFF, 0x7F, 0xF0, 0x00,
-    0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-    0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-    0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x07,
-    0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-    0xC0, 0x0F, 0xFF, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x7F, 0xF8,
-    0x03, 0xFF, 0xE0, 0x0F, 0xFE, 0x7F, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFE,
-    0x3F, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFE, 0x3F, 0xFC, 0x07, 0xFF, 0xE0,
-    0x1F, 0xFC, 0x3F, 0xFC, 0x07, 0xFF, 0xF0, 0x1F, 0xFC, 0x1F, 0xFC, 0x0F,
-    0xFF, 0xF0, 0x3F, 0xFC, 0x1F, 0xFC, 0x0F, 0xFF, 0xF0, 0x3F, 0xF8, 0x1F,
-    0xFE, 0x0F, 0xFF, 0xF8, 0x3F, 0xF8, 0x0F, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F,
-    0xF8, 0x0F, 0xFE, 0x1F, 0xFF, 0xF8, 0x7F, 0xF0, 0x0F, 0xFE, 0x1F, 0xFF,
-    0xFC, 0x7F, 0xF0, 0x07, 0xFF, 0x3F, 0xFF, 0xFC, 0x7F, 0xF0, 0x07, 0xFF,
-    0x3F, 0xFF, 0xFC, 0xFF, 0xE0, 0x07, 0xFF, 0x3F, 0xFF, 0xFE, 0xFF, 0xE0,
-    0x03, 0xFF, 0x3F, 0xF7, 0xFE, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE7, 0xFE,
-    0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xE3, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC0, 0x01,
-    0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF,
-    0x80, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x81,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x00,
-    0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x7F,
-    0xFE, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x3F, 0xFE,
-    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x00,
-    0x1F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFC, 0x7F,
-    0xFE, 0x01, 0xFF, 0xF0, 0x7F, 0xFE, 0x07, 0xFF, 0xC0, 0xFF, 0xFC, 0x0F,
-    0xFF, 0x00, 0xFF, 0xFC, 0x3F, 0xFE, 0x00, 0xFF, 0xF8, 0xFF, 0xF8, 0x01,
-    0xFF, 0xF9, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF,
-    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00,
-    0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF,
-    0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-    0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x7F,
-    0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
-    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0xFF,
-    0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xDF, 0xFF,
-    0x00, 0x1F, 0xFF, 0x3F, 0xFF, 0x00, 0x3F, 0xFC, 0x3F, 0xFE, 0x00, 0xFF,
-    0xF8, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x7F, 0xFE, 0x0F, 0xFF, 0x80, 0x7F,
-    0xFC, 0x1F, 0xFF, 0x00, 0xFF, 0xFC, 0x7F, 0xFC, 0x00, 0xFF, 0xFD, 0xFF,
-    0xF8, 0x01, 0xFF, 0xFC, 0xFF, 0xF8, 0x00, 0x7F, 0xFD, 0xFF, 0xF0, 0x03,
-    0xFF, 0xE7, 0xFF, 0xC0, 0x0F, 0xFF, 0x8F, 0xFF, 0x00, 0x3F, 0xFE, 0x3F,
-    0xFE, 0x00, 0xFF, 0xF0, 0xFF, 0xF8, 0x07, 0xFF, 0xC1, 0xFF, 0xE0, 0x1F,
-    0xFE, 0x07, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xFF, 0x03, 0xFF, 0xC0, 0x3F,
-    0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x3F, 0xFC, 0x01, 0xFF, 0xE1, 0xFF,
-    0xE0, 0x07, 0xFF, 0x87, 0xFF, 0x80, 0x0F, 0xFE, 0x1F, 0xFC, 0x00, 0x3F,
-    0xFC, 0x7F, 0xF0, 0x00, 0xFF, 0xF3, 0xFF, 0xC0, 0x01, 0xFF, 0xCF, 0xFE,
-    0x00, 0x07, 0xFF, 0xBF, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
-    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xE0,
-    0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x3F,
-    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFE, 0x00,
-    0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x3F,
-    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
-    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0xFF,
-    0xF0, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
-    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF,
-    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
-    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF0,
-    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00,
-    0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-    0xFE, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0xF7, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xBF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF0,
-    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00,
-    0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00,
-    0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F,
-    0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-    0xF0, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xF8,
-    0x03, 0xFF, 0xC0, 0x3F, 0xFE, 0x03, 0xFF, 0xF0, 0x3F, 0xFF, 0x83, 0xFF,
-    0xFC, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x0F, 0xFF, 0xC0, 0x7F, 0xF0, 0x03,
-    0xFF, 0x80, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-    0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
-    0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
-    0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x0F, 0xFE,
-    0x00, 0x7F, 0xFC, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFE, 0x00,
-    0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-    0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF8,
-    0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F,
-    0xFF, 0xF0, 0x3F, 0xFF, 0x81, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x1F, 0xFF,
-    0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x07, 0xFF, 0x80, 0x3F, 0xFE, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x7F,
-    0xFF, 0x83, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x1F, 0xFC,
-    0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07,
-    0xFE, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
-    0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F,
-    0xE0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x01, 0xFF, 0xF0,
-    0x03, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xFF, 0xE0, 0x3F, 0xFF, 0x03, 0xFF,
-    0xF8, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01,
-    0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-    0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x0F,
-    0xFE, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0x87, 0xFF, 0xFC, 0x3F, 0xFF, 0xC1,
-    0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x7F, 0xFF, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
-    0x00, 0xFF, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x00,
-    0x1F, 0xFE, 0x00, 0x18, 0x03, 0xFF, 0xFC, 0x01, 0xE0, 0x3F, 0xFF, 0xF8,
-    0x7F, 0x83, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xE1, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xE0, 0x7F, 0xFF, 0xE0, 0x1E, 0x00,
-    0xFF, 0xFE, 0x00, 0x60, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x00};
+    0x13, 0x0E, 0x23, 0x15, 0x1C, 0x1A, 0x18, 0x1E, 0x15, 0x21, 0x11, 0x24,
+    0x0F, 0x26, 0x0D, 0x28, 0x0B, 0x2A, 0x09, 0x2C, 0x08, 0x2D, 0x06, 0x2E,
+    0x05, 0x30, 0x04, 0x10, 0x10, 0x10, 0x03, 0x0F, 0x14, 0x0F, 0x02, 0x0D,
+    0x18, 0x0D, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0B, 0x1C, 0x0B, 0x01, 0x0C,
+    0x1C, 0x17, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x17,
+    0x1C, 0x0C, 0x01, 0x0B, 0x1C, 0x0B, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0D,
+    0x18, 0x0D, 0x02, 0x0E, 0x16, 0x0E, 0x03, 0x0F, 0x12, 0x0F, 0x04, 0x14,
+    0x08, 0x14, 0x05, 0x2E, 0x06, 0x2E, 0x07, 0x2C, 0x09, 0x2A, 0x0A, 0x29,
+    0x0D, 0x26, 0x0F, 0x24, 0x11, 0x22, 0x14, 0x1E, 0x17, 0x1C, 0x1B, 0x16,
+    0x21, 0x10, 0x12, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27,
+    0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0xFF, 0xFF,
+    0x65, 0x28, 0x01, 0x0A, 0x08, 0x20, 0x03, 0x08, 0x09, 0x1E, 0x05, 0x07,
+    0x0A, 0x1C, 0x07, 0x06, 0x0B, 0x1A, 0x09, 0x05, 0x0C, 0x18, 0x0B, 0x04,
+    0x0D, 0x16, 0x0C, 0x04, 0x0E, 0x14, 0x0E, 0x03, 0x0F, 0x12, 0x10, 0x02,
+    0x10, 0x13, 0x0E, 0x02, 0x11, 0x13, 0x0D, 0x02, 0x12, 0x13, 0x0D, 0x01,
+    0x13, 0x13, 0x0C, 0x01, 0x14, 0x13, 0x0B, 0x01, 0x15, 0x12, 0x0B, 0x01,
+    0x16, 0x12, 0x22, 0x11, 0x23, 0x10, 0x24, 0x0F, 0x25, 0x0E, 0x26, 0x0D,
+    0x16, 0x01, 0x10, 0x0B, 0x17, 0x02, 0x11, 0x08, 0x0C, 0x01, 0x0B, 0x03,
+    0x11, 0x06, 0x0D, 0x01, 0x0B, 0x04, 0x23, 0x01, 0x0B, 0x05, 0x22, 0x01,
+    0x0B, 0x06, 0x21, 0x01, 0x0B, 0x07, 0x1F, 0x02, 0x0B, 0x08, 0x1E, 0x02,
+    0x0B, 0x09, 0x1C, 0x03, 0x0B, 0x0A, 0x1A, 0x04, 0x0B, 0x0B, 0x19, 0x04,
+    0x0B, 0x0C, 0x17, 0x05, 0x0B, 0x0E, 0x13, 0x07, 0x0B, 0x0F, 0x11, 0x08,
+    0x0B, 0x12, 0x0C, 0x0A, 0x0B, 0x17, 0x01, 0x10, 0x0B, 0x28, 0x06, 0x02,
+    0x30, 0x04, 0x2F, 0x05, 0x2D, 0x07, 0x1D, 0x0B, 0x03, 0x09, 0x1C, 0x0B,
+    0x03, 0x0A, 0x1B, 0x0B, 0x02, 0x0C, 0x1A, 0x0B, 0x02, 0x0D, 0x19, 0x0B,
+    0x02, 0x0C, 0x1A, 0x0B, 0x01, 0x0C, 0x1B, 0x0B, 0x01, 0x0C, 0x1B, 0x0B,
+    0x01, 0x0B, 0x0C, 0x07, 0x09, 0x0B, 0x01, 0x0B, 0x0C, 0x09, 0x07, 0x0B,
+    0x01, 0x0A, 0x0D, 0x0A, 0x06, 0x16, 0x0D, 0x0B, 0x05, 0x16, 0x0D, 0x0C,
+    0x04, 0x16, 0x0D, 0x0D, 0x03, 0x16, 0x0D, 0x0E, 0x02, 0x16, 0x0D, 0x26,
+    0x0D, 0x27, 0x0C, 0x1B, 0x01, 0x0B, 0x0B, 0x1C, 0x01, 0x0C, 0x0A, 0x1C,
+    0x01, 0x0D, 0x08, 0x1D, 0x01, 0x0F, 0x04, 0x1F, 0x02, 0x31, 0x02, 0x1E,
+    0x01, 0x12, 0x02, 0x1D, 0x03, 0x11, 0x03, 0x1C, 0x05, 0x0F, 0x03, 0x1C,
+    0x06, 0x0E, 0x04, 0x1A, 0x08, 0x0D, 0x05, 0x18, 0x0A, 0x0C, 0x06, 0x17,
+    0x0B, 0x0B, 0x07, 0x15, 0x0D, 0x0A, 0x08, 0x12, 0x10, 0x09, 0x0A, 0x0F,
+    0x12, 0x08, 0x0C, 0x0A, 0x1D, 0x0A, 0x08, 0x2A, 0x0A, 0x28, 0x0C, 0x26,
+    0x0E, 0x24, 0x10, 0x22, 0x12, 0x20, 0x14, 0x1E, 0x16, 0x1C, 0x18, 0x1A,
+    0x1B, 0x17, 0x1D, 0x15, 0x1F, 0x13, 0x21, 0x11, 0x23, 0x0F, 0x25, 0x0D,
+    0x27, 0x0B, 0x0B, 0x02, 0x1B, 0x0A, 0x0B, 0x05, 0x18, 0x0A, 0x0B, 0x07,
+    0x16, 0x0A, 0x0B, 0x09, 0x14, 0x0A, 0x0B, 0x0B, 0x12, 0x0A, 0x0B, 0x0D,
+    0x10, 0x0A, 0x0B, 0x0F, 0x0E, 0x0A, 0x0B, 0x11, 0x2A, 0x0A, 0x28, 0x0C,
+    0x26, 0x0E, 0x24, 0x10, 0x22, 0x12, 0x20, 0x14, 0x1E, 0x14, 0x1E, 0x14,
+    0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x1E, 0x0B, 0x27, 0x0B, 0x27,
+    0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x1D, 0x06, 0x02, 0x30, 0x04, 0x2F, 0x05,
+    0x2D, 0x07, 0x10, 0x03, 0x18, 0x09, 0x0E, 0x0E, 0x0E, 0x0A, 0x0C, 0x18,
+    0x04, 0x0C, 0x0A, 0x1B, 0x02, 0x0D, 0x08, 0x1C, 0x02, 0x0C, 0x09, 0x1C,
+    0x01, 0x0C, 0x0B, 0x1B, 0x01, 0x0B, 0x0C, 0x1B, 0x01, 0x0B, 0x0C, 0x1B,
+    0x01, 0x0B, 0x0D, 0x1A, 0x01, 0x0A, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x09,
+    0x04, 0x18, 0x0E, 0x09, 0x06, 0x16, 0x0E, 0x09, 0x06, 0x16, 0x0E, 0x09,
+    0x06, 0x16, 0x0E, 0x09, 0x06, 0x17, 0x0C, 0x0A, 0x06, 0x0B, 0x01, 0x0B,
+    0x0C, 0x0A, 0x06, 0x0B, 0x01, 0x0C, 0x0A, 0x0B, 0x06, 0x0B, 0x01, 0x0D,
+    0x08, 0x0C, 0x06, 0x0B, 0x01, 0x0F, 0x04, 0x0E, 0x06, 0x0B, 0x01, 0x20,
+    0x07, 0x0B, 0x02, 0x1F, 0x07, 0x0B, 0x02, 0x1F, 0x07, 0x0B, 0x03, 0x1D,
+    0x08, 0x0B, 0x03, 0x1D, 0x08, 0x0B, 0x04, 0x1B, 0x09, 0x0B, 0x05, 0x19,
+    0x0A, 0x0B, 0x06, 0x17, 0x0B, 0x0B, 0x07, 0x15, 0x0C, 0x0B, 0x08, 0x13,
+    0x22, 0x0F, 0x27, 0x09, 0x1D, 0x11, 0x02, 0x2C, 0x0C, 0x25, 0x10, 0x21,
+    0x14, 0x1E, 0x17, 0x1B, 0x19, 0x19, 0x1C, 0x16, 0x1E, 0x14, 0x21, 0x12,
+    0x22, 0x10, 0x25, 0x0E, 0x26, 0x0C, 0x28, 0x0B, 0x0D, 0x08, 0x15, 0x09,
+    0x0C, 0x0A, 0x15, 0x08, 0x0B, 0x0C, 0x16, 0x05, 0x0B, 0x0E, 0x16, 0x04,
+    0x0B, 0x0E, 0x18, 0x02, 0x0B, 0x0E, 0x19, 0x01, 0x0B, 0x0E, 0x25, 0x0E,
+    0x25, 0x0E, 0x09, 0x01, 0x1C, 0x0D, 0x09, 0x02, 0x0F, 0x01, 0x0B, 0x0C,
+    0x0A, 0x04, 0x0D, 0x01, 0x0C, 0x0A, 0x0B, 0x05, 0x0C, 0x01, 0x0E, 0x07,
+    0x0C, 0x06, 0x0B, 0x01, 0x21, 0x08, 0x09, 0x02, 0x1F, 0x0A, 0x08, 0x02,
+    0x1F, 0x0C, 0x06, 0x03, 0x1D, 0x0E, 0x05, 0x03, 0x1D, 0x0F, 0x04, 0x04,
+    0x1B, 0x12, 0x02, 0x05, 0x19, 0x14, 0x01, 0x06, 0x18, 0x1C, 0x15, 0x1F,
+    0x13, 0x22, 0x0F, 0x26, 0x0B, 0x1C, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0D, 0x25, 0x10, 0x22, 0x13,
+    0x1F, 0x15, 0x1D, 0x18, 0x1A, 0x1B, 0x17, 0x1D, 0x15, 0x20, 0x12, 0x22,
+    0x10, 0x25, 0x0D, 0x28, 0x0A, 0x2A, 0x08, 0x2D, 0x05, 0x0B, 0x03, 0x22,
+    0x02, 0x0B, 0x05, 0x2D, 0x08, 0x2A, 0x0B, 0x27, 0x0E, 0x24, 0x10, 0x22,
+    0x13, 0x1F, 0x16, 0x1C, 0x19, 0x19, 0x1B, 0x17, 0x1E, 0x14, 0x21, 0x11,
+    0x24, 0x0E, 0x26, 0x0C, 0x29, 0x09, 0x0A, 0x0A, 0x28, 0x0E, 0x25, 0x11,
+    0x09, 0x0A, 0x0E, 0x14, 0x06, 0x0E, 0x0C, 0x15, 0x04, 0x10, 0x0A, 0x17,
+    0x02, 0x12, 0x08, 0x18, 0x01, 0x14, 0x07, 0x2E, 0x05, 0x30, 0x04, 0x30,
+    0x03, 0x31, 0x03, 0x32, 0x02, 0x0D, 0x06, 0x1F, 0x02, 0x0B, 0x09, 0x0E,
+    0x04, 0x0C, 0x02, 0x0B, 0x0A, 0x0B, 0x07, 0x0B, 0x01, 0x0B, 0x0B, 0x0A,
+    0x09, 0x16, 0x0C, 0x09, 0x09, 0x16, 0x0C, 0x09, 0x0A, 0x15, 0x0C, 0x09,
+    0x0A, 0x15, 0x0C, 0x09, 0x09, 0x16, 0x0B, 0x0A, 0x09, 0x0B, 0x01, 0x0B,
+    0x0A, 0x0B, 0x07, 0x0C, 0x01, 0x0B, 0x09, 0x0D, 0x05, 0x0C, 0x02, 0x0C,
+    0x07, 0x1F, 0x02, 0x32, 0x02, 0x32, 0x03, 0x30, 0x04, 0x30, 0x04, 0x2F,
+    0x06, 0x18, 0x01, 0x14, 0x08, 0x17, 0x02, 0x12, 0x09, 0x16, 0x04, 0x10,
+    0x0B, 0x14, 0x06, 0x0E, 0x0E, 0x11, 0x09, 0x0A, 0x11, 0x0E, 0x28, 0x0A,
+    0x20, 0x1F, 0x04, 0x2B, 0x0C, 0x25, 0x11, 0x21, 0x13, 0x1E, 0x16, 0x1C,
+    0x18, 0x06, 0x01, 0x13, 0x1A, 0x05, 0x03, 0x11, 0x1B, 0x04, 0x04, 0x0F,
+    0x1D, 0x03, 0x05, 0x0D, 0x1E, 0x03, 0x07, 0x0B, 0x1F, 0x02, 0x08, 0x0A,
+    0x1F, 0x02, 0x09, 0x08, 0x21, 0x01, 0x0B, 0x06, 0x0C, 0x08, 0x0D, 0x01,
+    0x0C, 0x05, 0x0B, 0x0A, 0x0C, 0x01, 0x0E, 0x03, 0x0A, 0x0C, 0x0B, 0x01,
+    0x0F, 0x02, 0x09, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x0B, 0x01,
+    0x19, 0x0E, 0x0B, 0x02, 0x18, 0x0E, 0x0B, 0x04, 0x16, 0x0D, 0x0C, 0x05,
+    0x16, 0x0C, 0x0B, 0x08, 0x15, 0x0A, 0x0C, 0x09, 0x15, 0x07, 0x0E, 0x0B,
+    0x28, 0x0C, 0x26, 0x0F, 0x24, 0x10, 0x22, 0x13, 0x20, 0x14, 0x1E, 0x17,
+    0x1B, 0x19, 0x19, 0x1C, 0x16, 0x1E, 0x14, 0x21, 0x10, 0x26, 0x0B, 0x0C,
+    0x04, 0x07, 0x0D, 0x07, 0x06, 0x0A, 0x0B, 0x0A, 0x03, 0x0C, 0x09, 0x0C,
+    0x02, 0x0D, 0x07, 0x0D, 0x02, 0x0D, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x1C,
+    0x07, 0x1C, 0x07, 0x0E, 0x01, 0x0D, 0x07, 0x0D, 0x02, 0x0C, 0x09, 0x0C,
+    0x03, 0x0B, 0x0A, 0x0A, 0x05, 0x08, 0x0D, 0x08, 0x09, 0x02, 0x13, 0x02,
+    0x06};
+
+constexpr GFXglyph Outfit_80036pt7bGlyphs[] PROGMEM = {
+    {0, 43, 52, 47, 2, -50},      // 0x30 '0'
+    {111, 22, 50, 28, 1, -49},    // 0x31 '1'
+    {133, 38, 51, 41, 1, -50},    // 0x32 '2'
+    {274, 37, 51, 40, 1, -49},    // 0x33 '3'
+    {413, 41, 50, 43, 1, -49},    // 0x34 '4'
+    {510, 37, 51, 40, 1, -49},    // 0x35 '5'
+    {653, 38, 51, 41, 1, -49},    // 0x36 '6'
+    {774, 35, 50, 37, 1, -49},    // 0x37 '7'
+    {846, 36, 52, 40, 2, -50},    // 0x38 '8'
+    {973, 38, 51, 41, 1, -50},    // 0x39 '9'
+    {1092, 14, 35, 21, 4, -33}};  // 0x3A ':'
 
-const GFXglyph Outfit_80036pt7bGlyphs[] PROGMEM = {
-    {0, 1, 1, 13, 0, 0},          // 0x20 ' '
-    {1, 14, 52, 21, 3, -50},      // 0x21 '!'
-    {92, 27, 22, 33, 3, -50},     // 0x22 '"'
-    {167, 43, 50, 47, 2, -49},    // 0x23 '#'
-    {436, 38, 64, 43, 2, -56},    // 0x24 '$'
-    {740, 45, 52, 49, 2, -50},    // 0x25 '%'
-    {1033, 47, 52, 49, 2, -50},   // 0x26 '&'
-    {1339, 12, 22, 18, 3, -50},   // 0x27 '''
-    {1372, 19, 63, 22, 2, -53},   // 0x28 '('
-    {1522, 19, 63, 22, 1, -53},   // 0x29 ')'
-    {1672, 30, 31, 34, 2, -51},   // 0x2A '*'
-    {1789, 34, 35, 40, 3, -40},   // 0x2B '+'
-    {1938, 14, 25, 20, 3, -12},   // 0x2C ','
-    {1982, 25, 10, 33, 4, -22},   // 0x2D '-'
-    {2014, 14, 14, 21, 4, -12},   // 0x2E '.'
-    {2039, 27, 58, 27, 0, -53},   // 0x2F '/'
-    {2235, 43, 52, 47, 2, -50},   // 0x30 '0'
-    {2515, 22, 50, 28, 1, -49},   // 0x31 '1'
-    {2653, 38, 51, 41, 1, -50},   // 0x32 '2'
-    {2896, 37, 51, 40, 1, -49},   // 0x33 '3'
-    {3132, 41, 50, 43, 1, -49},   // 0x34 '4'
-    {3389, 37, 51, 40, 1, -49},   // 0x35 '5'
-    {3625, 38, 51, 41, 1, -49},   // 0x36 '6'
-    {3868, 35, 50, 37, 1, -49},   // 0x37 '7'
-    {4087, 36, 52, 40, 2, -50},   // 0x38 '8'
-    {4321, 38, 51, 41, 1, -50},   // 0x39 '9'
-    {4564, 14, 35, 21, 4, -33},   // 0x3A ':'
-    {4626, 14, 46, 20, 3, -33},   // 0x3B ';'
-    {4707, 34, 36, 41, 3, -41},   // 0x3C '<'
-    {4860, 34, 27, 40, 3, -36},   // 0x3D '='
-    {4975, 33, 36, 41, 4, -41},   // 0x3E '>'
-    {5124, 32, 53, 35, 1, -51},   // 0x3F '?'
-    {5336, 48, 48, 54, 3, -39},   // 0x40 '@'
-    {5624, 51, 50, 52, 1, -49},   // 0x41 'A'
-    {5943, 40, 50, 46, 4, -49},   // 0x42 'B'
-    {6193, 46, 52, 49, 2, -50},   // 0x43 'C'
-    {6492, 48, 50, 54, 4, -49},   // 0x44 'D'
-    {6792, 38, 50, 44, 4, -49},   // 0x45 'E'
-    {7030, 36, 50, 42, 4, -49},   // 0x46 'F'
-    {7255, 52, 52, 56, 2, -50},   // 0x47 'G'
-    {7593, 44, 50, 52, 4, -49},   // 0x48 'H'
-    {7868, 13, 50, 22, 4, -49},   // 0x49 'I'
-    {7950, 34, 51, 39, 1, -49},   // 0x4A 'J'
-    {8167, 46, 50, 51, 4, -49},   // 0x4B 'K'
-    {8455, 35, 50, 40, 4, -49},   // 0x4C 'L'
-    {8674, 53, 50, 61, 4, -49},   // 0x4D 'M'
-    {9006, 44, 50, 53, 4, -49},   // 0x4E 'N'
-    {9281, 53, 52, 57, 2, -50},   // 0x4F 'O'
-    {9626, 40, 50, 45, 4, -49},   // 0x50 'P'
-    {9876, 56, 55, 58, 2, -50},   // 0x51 'Q'
-    {10261, 42, 50, 47, 4, -49},  // 0x52 'R'
-    {10524, 39, 52, 42, 1, -50},  // 0x53 'S'
-    {10778, 43, 50, 46, 1, -49},  // 0x54 'T'
-    {11047, 42, 51, 50, 4, -49},  // 0x55 'U'
-    {11315, 49, 50, 51, 1, -49},  // 0x56 'V'
-    {11622, 70, 50, 71, 1, -49},  // 0x57 'W'
-    {12060, 49, 50, 51, 1, -49},  // 0x58 'X'
-    {12367, 47, 50, 49, 1, -49},  // 0x59 'Y'
-    {12661, 39, 50, 44, 2, -49},  // 0x5A 'Z'
-    {12905, 19, 58, 25, 4, -50},  // 0x5B '['
-    {13043, 27, 58, 27, 0, -53},  // 0x5C '\'
-    {13239, 19, 58, 25, 2, -50},  // 0x5D ']'
-    {13377, 29, 19, 33, 2, -50},  // 0x5E '^'
-    {13446, 36, 9, 36, 0, 4},     // 0x5F '_'
-    {13487, 18, 16, 24, 3, -51},  // 0x60 '`'
-    {13523, 38, 36, 43, 1, -34},  // 0x61 'a'
-    {13694, 37, 52, 43, 4, -50},  // 0x62 'b'
-    {13935, 33, 36, 35, 1, -34},  // 0x63 'c'
-    {14084, 38, 52, 43, 1, -50},  // 0x64 'd'
-    {14331, 37, 36, 39, 1, -34},  // 0x65 'e'
-    {14498, 35, 52, 32, 0, -51},  // 0x66 'f'
-    {14726, 37, 51, 41, 1, -34},  // 0x67 'g'
-    {14962, 34, 51, 41, 4, -50},  // 0x68 'h'
-    {15179, 13, 52, 19, 3, -51},  // 0x69 'i'
-    {15264, 26, 68, 20, -9, -51}, // 0x6A 'j'
-    {15485, 36, 51, 40, 4, -50},  // 0x6B 'k'
-    {15715, 12, 51, 19, 4, -50},  // 0x6C 'l'
-    {15792, 55, 35, 62, 4, -34},  // 0x6D 'm'
-    {16033, 34, 35, 41, 4, -34},  // 0x6E 'n'
-    {16182, 39, 36, 41, 1, -34},  // 0x6F 'o'
-    {16358, 37, 50, 43, 4, -34},  // 0x70 'p'
-    {16590, 38, 50, 43, 1, -34},  // 0x71 'q'
-    {16828, 28, 35, 32, 4, -34},  // 0x72 'r'
-    {16951, 32, 37, 33, 0, -35},  // 0x73 's'
-    {17099, 27, 49, 29, 1, -48},  // 0x74 't'
-    {17265, 33, 35, 39, 3, -33},  // 0x75 'u'
-    {17410, 39, 34, 39, 0, -33},  // 0x76 'v'
-    {17576, 56, 34, 56, 0, -33},  // 0x77 'w'
-    {17814, 39, 34, 39, 0, -33},  // 0x78 'x'
-    {17980, 38, 49, 38, 0, -33},  // 0x79 'y'
-    {18213, 31, 34, 35, 2, -33},  // 0x7A 'z'
-    {18345, 21, 58, 25, 1, -50},  // 0x7B '{'
-    {18498, 11, 64, 22, 5, -54},  // 0x7C '|'
-    {18586, 21, 58, 25, 2, -50},  // 0x7D '}'
-    {18739, 37, 14, 43, 3, -31}}; // 0x7E '~'
+const GFXfont Outfit_80036pt7b PROGMEM = {(uint8_t *)Outfit_80036pt7bBitmaps, (GFXglyph *)Outfit_80036pt7bGlyphs, 0x30, 0x3A, 89, GFXFONT_RLE | GFXFONT_ROTATED(1)};
 
-const GFXfont Outfit_80036pt7b PROGMEM = {
-    (uint8_t *)Outfit_80036pt7bBitmaps,
-    (GFXglyph *)Outfit_80036pt7bGlyphs,
-    0x20, 0x7E, 89};
+constexpr FontMetrics Outfit_80036pt7bMetrics = {Outfit_80036pt7bGlyphs, 0x30, 0x3A};
 
-// Approx. 19476 bytes
+// Approx. 1225 bytes
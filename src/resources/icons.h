@@ -1,153 +1,205 @@
 #pragma once
 
-#include "Arduino.h"
-
-// Use https://javl.github.io/image2cpp/
-// with inverted color and black background
-
-// ----- qpaperOS LOGO -----
-
-const unsigned char qpaperos_logo_100[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1b, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xec, 0x95, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x66, 0xd6, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x33, 0x6b, 0x4b, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0x99, 0x29, 0xb2, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0xcd, 0xb6, 0xb6,
-    0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x66, 0x66, 0xd6, 0x4d, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xb3, 0xb2,
-    0x59, 0xd9, 0x7b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x9a, 0x9d, 0xad, 0x36, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c,
-    0xcc, 0xcd, 0xa6, 0xcd, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0x67, 0x66, 0x72, 0xdb, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x02, 0xd3, 0x39, 0x33, 0x5b, 0x33, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6c, 0xcd, 0x99, 0x99, 0xa7, 0xff, 0xcc, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0d, 0xad, 0xb6, 0xdc, 0xa6, 0xbb, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x93, 0x32, 0x60, 0x00, 0x4b, 0xff, 0xb3, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x12, 0x76, 0x4d, 0x00, 0x00, 0x1b, 0xff, 0x9d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x36, 0xcd, 0xd8, 0x00, 0x00, 0x03, 0xff,
-    0x64, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xb2, 0x60, 0x00, 0x00, 0x01, 0xfd, 0x6e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x36, 0xa0, 0x00, 0x00,
-    0x03, 0xcd, 0x9b, 0x60, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x4d, 0x80, 0x00, 0x00, 0x03, 0x32, 0xb1, 0xa0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xd9, 0x00,
-    0x00, 0x00, 0x07, 0x1a, 0xcc, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xa4, 0xb2, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x6e, 0xd8, 0x00, 0x00, 0x00, 0x01, 0x6d,
-    0xae, 0x00, 0x00, 0x00, 0x0c, 0x05, 0x33, 0x48, 0x00, 0x00, 0x00, 0x03, 0x33, 0x48, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x99, 0x6c, 0x00, 0x00, 0x00,
-    0x02, 0xcc, 0xd8, 0x00, 0x00, 0x00, 0x38, 0x00, 0xcd, 0xb0, 0x00, 0x00, 0x00, 0x06, 0xdb, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0xe6, 0x9c, 0x00,
-    0x00, 0x00, 0x05, 0x33, 0x61, 0xe0, 0x00, 0x00, 0x70, 0x00, 0xb2, 0xc0, 0x00, 0x00, 0x00, 0x05, 0xac, 0xc3, 0xf0, 0x00, 0x00, 0xe0, 0x00, 0x5b,
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0xcd, 0x87, 0xf0, 0x00, 0x00, 0xe0, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x73, 0x67, 0xf8, 0x00, 0x01, 0xc0,
-    0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1a, 0x47, 0xf8, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcd, 0x87, 0xfc, 0x00,
-    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xb5, 0x83, 0xff, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x36, 0x01,
-    0xc3, 0x83, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xca, 0x80, 0x00, 0xe7, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0xdb, 0x80, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x12, 0xcd, 0x80, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xdb, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x1b, 0x32, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcd, 0x80, 0x00, 0x0f, 0xfe, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xd9, 0x80, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x36, 0x00, 0x00, 0x07, 0xfc,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xa6, 0x80, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd9, 0x80, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x66,
-    0xc0, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xac, 0xc0, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0xb3, 0x20, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd6, 0xc0, 0x00, 0x00, 0x00, 0xdb, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x59, 0xb0, 0x00, 0x00, 0x01, 0x99, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6d, 0x20, 0x00, 0x00, 0x00, 0xa6, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x03, 0x26, 0xd8, 0x00, 0x00, 0x00, 0xed, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xda, 0xd0, 0x00, 0x00, 0x00, 0x59,
-    0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd9, 0x34, 0x00, 0x00, 0x00, 0x52, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0x6c, 0x00, 0x00,
-    0x00, 0x36, 0xd9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0xcb, 0x00, 0x00, 0x00, 0x2d, 0x9a, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0x33,
-    0x00, 0x00, 0x00, 0x29, 0x66, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6c, 0xc0, 0x00, 0x00, 0x1b, 0x59, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x6c, 0xcd, 0xa0, 0x00, 0x00, 0x16, 0xcd, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x93, 0x38, 0x00, 0x00, 0x0c, 0xb6, 0x67, 0x80, 0x00, 0x00,
-    0x00, 0x00, 0x16, 0x76, 0xcc, 0x00, 0x00, 0x0b, 0x33, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xcc, 0xd7, 0x00, 0x00, 0x19, 0xcd, 0xbb, 0x70,
-    0x00, 0x00, 0x00, 0x00, 0x0b, 0x33, 0x33, 0xe0, 0x01, 0xe6, 0x6c, 0xa6, 0x98, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb6, 0xcc, 0xbf, 0xfe, 0x6d, 0xb3,
-    0x6c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcc, 0xd9, 0x92, 0x4b, 0x33, 0x36, 0x59, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x5b, 0x36, 0x6d, 0xb3,
-    0x9a, 0xcd, 0x97, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x66, 0xcd, 0x9c, 0xcc, 0xd9, 0xb4, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xc9,
-    0xb2, 0x65, 0x67, 0x32, 0x6b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xbb, 0x36, 0xdb, 0x33, 0x66, 0xcb, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0b, 0x26, 0x4d, 0x9a, 0xd9, 0x9b, 0x34, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x6d, 0xd9, 0x66, 0xcc, 0xd9, 0xb6, 0x80, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x99, 0x33, 0x59, 0x36, 0x66, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xcc, 0xd7, 0x67, 0x36, 0x68, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xdb, 0x34, 0xd9, 0x99, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x66, 0x98, 0x2d, 0x90,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcb, 0x60, 0x26, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb8, 0x00,
-    0x1a, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// Generated by tools/assetconvert.py, do not edit. Regenerate with:
+// python3 tools/assetconvert.py --rotate 1 --rle -o src/resources/icons.h assets/icons/ui/*.png
+
+#include "lib/asset.h"
+
+const uint8_t icon_battery_0_small_data[] PROGMEM = {
+    0x24, 0x0b, 0x10, 0x0e, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x0e, 0x0f, 0x0c, 0x2f, 0x06, 0x17, 0x04, 0x28};
+const Asset icon_battery_0_small = {icon_battery_0_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_battery_100_small_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x9f, 0x98, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const Asset icon_battery_100_small = {icon_battery_100_small_data, 28, 28, AssetEncoding::RAW, true, 1};
+
+const uint8_t icon_battery_20_small_data[] PROGMEM = {
+    0x24, 0x0b, 0x10, 0x0e, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02,
+    0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x0e, 0x0f, 0x0c, 0x2f, 0x06, 0x17, 0x04,
+    0x28};
+const Asset icon_battery_20_small = {icon_battery_20_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_battery_40_small_data[] PROGMEM = {
+    0x24, 0x0b, 0x10, 0x0e, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02,
+    0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x0e, 0x0f, 0x0c,
+    0x2f, 0x06, 0x17, 0x04, 0x28};
+const Asset icon_battery_40_small = {icon_battery_40_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_battery_60_small_data[] PROGMEM = {
+    0x24, 0x0b, 0x10, 0x0e, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02,
+    0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02,
+    0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02,
+    0x0a, 0x02, 0x0e, 0x0e, 0x0f, 0x0c, 0x2f, 0x06, 0x17, 0x04, 0x28};
+const Asset icon_battery_60_small = {icon_battery_60_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_battery_80_small_data[] PROGMEM = {
+    0x24, 0x0b, 0x10, 0x0e, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02,
+    0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x01, 0x08, 0x01, 0x02,
+    0x0e, 0x02, 0x01, 0x08, 0x01, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x02,
+    0x0a, 0x02, 0x0e, 0x02, 0x0a, 0x02, 0x0e, 0x0e, 0x0f, 0x0c, 0x2f, 0x06, 0x17, 0x04, 0x28};
+const Asset icon_battery_80_small = {icon_battery_80_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_gps_small_data[] PROGMEM = {
+    0x61, 0x02, 0x1a, 0x02, 0x18, 0x06, 0x14, 0x0a, 0x11, 0x04, 0x05, 0x03, 0x0f, 0x03, 0x08, 0x03,
+    0x0d, 0x03, 0x0a, 0x03, 0x0c, 0x02, 0x04, 0x04, 0x04, 0x02, 0x0b, 0x02, 0x04, 0x06, 0x03, 0x03,
+    0x0a, 0x02, 0x03, 0x08, 0x03, 0x02, 0x08, 0x04, 0x03, 0x08, 0x03, 0x04, 0x06, 0x04, 0x03, 0x08,
+    0x03, 0x04, 0x08, 0x02, 0x03, 0x08, 0x03, 0x02, 0x0a, 0x03, 0x03, 0x06, 0x04, 0x02, 0x0b, 0x02,
+    0x04, 0x04, 0x04, 0x02, 0x0c, 0x03, 0x0a, 0x03, 0x0d, 0x03, 0x08, 0x03, 0x0f, 0x03, 0x05, 0x04,
+    0x11, 0x0a, 0x14, 0x06, 0x18, 0x02, 0x1a, 0x02, 0x61};
+const Asset icon_gps_small = {icon_gps_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_no_ble_small_data[] PROGMEM = {
+    0x83, 0x02, 0x19, 0x03, 0x19, 0x02, 0x0f, 0x02, 0x08, 0x03, 0x0f, 0x02, 0x07, 0x03, 0x10, 0x03,
+    0x06, 0x02, 0x12, 0x03, 0x04, 0x03, 0x0d, 0x09, 0x02, 0x03, 0x03, 0x05, 0x05, 0x0a, 0x02, 0x02,
+    0x03, 0x07, 0x05, 0x09, 0x01, 0x03, 0x04, 0x05, 0x07, 0x03, 0x01, 0x03, 0x01, 0x03, 0x06, 0x03,
+    0x08, 0x07, 0x01, 0x02, 0x01, 0x02, 0x03, 0x03, 0x0a, 0x05, 0x01, 0x03, 0x01, 0x03, 0x01, 0x04,
+    0x0b, 0x03, 0x01, 0x03, 0x03, 0x06, 0x0d, 0x02, 0x01, 0x02, 0x05, 0x04, 0x10, 0x03, 0x06, 0x02,
+    0x10, 0x03, 0x19, 0x02, 0x19, 0x03, 0x19, 0x02, 0x83};
+const Asset icon_no_ble_small = {icon_no_ble_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_prayer_small_data[] PROGMEM = {
+    0x45, 0x02, 0x19, 0x04, 0x17, 0x06, 0x11, 0x10, 0x0b, 0x12, 0x0a, 0x12, 0x0a, 0x08, 0x02, 0x08,
+    0x0a, 0x06, 0x06, 0x06, 0x0a, 0x05, 0x08, 0x05, 0x09, 0x05, 0x0a, 0x05, 0x07, 0x06, 0x04, 0x05,
+    0x01, 0x06, 0x05, 0x06, 0x04, 0x0e, 0x04, 0x06, 0x04, 0x0e, 0x05, 0x06, 0x03, 0x03, 0x01, 0x01,
+    0x01, 0x07, 0x07, 0x05, 0x03, 0x04, 0x03, 0x05, 0x09, 0x05, 0x02, 0x03, 0x03, 0x05, 0x0a, 0x06,
+    0x02, 0x04, 0x01, 0x05, 0x0a, 0x08, 0x01, 0x09, 0x0a, 0x12, 0x0a, 0x12, 0x0b, 0x10, 0x11, 0x06,
+    0x17, 0x04, 0x19, 0x02, 0x45};
+const Asset icon_prayer_small = {icon_prayer_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_steps_small_data[] PROGMEM = {
+    0x7c, 0x06, 0x14, 0x0a, 0x0e, 0x02, 0x01, 0x0b, 0x0d, 0x03, 0x01, 0x0c, 0x0b, 0x04, 0x01, 0x0b,
+    0x0b, 0x05, 0x02, 0x0a, 0x0b, 0x06, 0x01, 0x09, 0x0c, 0x06, 0x01, 0x07, 0x0f, 0x05, 0x03, 0x01,
+    0x50, 0x04, 0x03, 0x01, 0x13, 0x05, 0x02, 0x06, 0x0e, 0x06, 0x01, 0x09, 0x0d, 0x05, 0x01, 0x0a,
+    0x0c, 0x05, 0x01, 0x0b, 0x0c, 0x03, 0x02, 0x0b, 0x0e, 0x01, 0x02, 0x0b, 0x11, 0x0a, 0x15, 0x06,
+    0x75};
+const Asset icon_steps_small = {icon_steps_small_data, 28, 28, AssetEncoding::RLE, true, 1};
+
+const uint8_t icon_weather_small_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00,
+    0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 0x04, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x1c, 0x22, 0x1c, 0x00,
+    0x1c, 0xf7, 0xc8, 0x00, 0x1c, 0xff, 0xe0, 0x00, 0x1c, 0xf8, 0xe0, 0x00, 0x0c, 0xd8, 0x70, 0x00,
+    0x0c, 0xd8, 0x30, 0x00, 0x0f, 0xd8, 0x3b, 0xc0, 0x0f, 0x98, 0x3b, 0xc0, 0x07, 0x80, 0x30, 0x00,
+    0x00, 0x60, 0x70, 0x00, 0x00, 0x70, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x01, 0x1f, 0x88, 0x00,
+    0x03, 0x80, 0x1c, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x02, 0x06, 0x04, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const Asset icon_weather_small = {icon_weather_small_data, 28, 28, AssetEncoding::RAW, true, 1};
+
+const uint8_t icon_wifi_small_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x0e, 0x38, 0x00, 0x00, 0x0f, 0x1c, 0x00,
+    0x00, 0xc7, 0x0c, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0x71, 0x8e, 0x00,
+    0x00, 0x71, 0xc6, 0x00, 0x0e, 0x31, 0xc6, 0x00, 0x0e, 0x31, 0xc6, 0x00, 0x00, 0x71, 0xc6, 0x00,
+    0x00, 0x71, 0x8e, 0x00, 0x00, 0xe1, 0x8e, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0xc7, 0x0c, 0x00,
+    0x00, 0x0f, 0x1c, 0x00, 0x00, 0x0e, 0x38, 0x00, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const Asset icon_wifi_small = {icon_wifi_small_data, 28, 28, AssetEncoding::RAW, true, 1};
+
+const uint8_t qpaperos_logo_100_data[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0xe6, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x99, 0x8c,
+    0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x33, 0x7b, 0x31, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x49, 0xb6, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xb1, 0xcd, 0xb6, 0xcd, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x37, 0x39, 0xb6, 0x59, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xcc, 0xe6,
+    0x49, 0x96, 0x79, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xb3, 0x9b, 0x6d, 0xb3, 0x4c,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x36, 0x59, 0xb6, 0x6d, 0xa7, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x9c, 0xcd, 0x66, 0x99, 0xcc, 0xb9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x73, 0x59, 0xb6, 0x67, 0x33, 0x4c, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x66,
+    0x99, 0xb4, 0xdb, 0x67, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xac, 0x9b, 0x6d, 0x96, 0xcc,
+    0xb9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x36, 0xd9, 0x60, 0x00, 0x36, 0xcc, 0xcd, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xd3, 0x66, 0x80, 0x00, 0x13, 0x33, 0x59, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0xd9, 0x3a, 0x00, 0x00, 0x01, 0x9b, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x33, 0x26,
+    0xc8, 0x00, 0x00, 0x00, 0xec, 0x9b, 0x60, 0x00, 0x00, 0x00, 0x00, 0x59, 0xb6, 0x60, 0x00, 0x00,
+    0x78, 0x26, 0xd9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd9, 0x80, 0x00, 0x00, 0xfc, 0x33, 0x66,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x4d, 0x80, 0x00, 0x01, 0xfe, 0x0c, 0xb6, 0x48, 0x00, 0x00,
+    0x00, 0x01, 0x99, 0xb6, 0x00, 0x00, 0x01, 0xfe, 0x06, 0x99, 0xd8, 0x00, 0x00, 0x00, 0x01, 0x4d,
+    0xb2, 0x00, 0x00, 0x01, 0xfe, 0x01, 0xcb, 0x34, 0x00, 0x00, 0x00, 0x02, 0x76, 0x4c, 0x00, 0x00,
+    0x00, 0xfe, 0x03, 0x36, 0x64, 0x00, 0x00, 0x00, 0x03, 0x93, 0x68, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0xb4, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x98, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xcd, 0x9a, 0x00,
+    0x00, 0x00, 0x03, 0x66, 0xb0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x5b, 0x32, 0x00, 0x00, 0x00, 0x07,
+    0x36, 0x60, 0x00, 0x00, 0x01, 0x80, 0x00, 0x32, 0xe6, 0x00, 0x00, 0x00, 0x04, 0xd9, 0x60, 0x00,
+    0x00, 0x01, 0x80, 0x00, 0x4e, 0x4d, 0x00, 0x00, 0x00, 0x0b, 0x4d, 0xc0, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x19, 0xd9, 0x00, 0x00, 0x00, 0x0b, 0x66, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x04, 0x9a, 0xc0, 0x00, 0x00, 0x06, 0x00, 0x00, 0x26, 0x67, 0x00, 0x00, 0x00,
+    0x06, 0xd9, 0x80, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x1c, 0xcc, 0x80, 0x00, 0x00, 0x0b, 0x66, 0x80,
+    0x00, 0x01, 0xfc, 0x00, 0x00, 0x19, 0x99, 0x80, 0x00, 0x00, 0x19, 0x36, 0x80, 0x00, 0x03, 0xfe,
+    0x00, 0x00, 0x13, 0xb3, 0x00, 0x00, 0x00, 0x06, 0x99, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00, 0x06,
+    0x66, 0x80, 0x00, 0x00, 0x16, 0xe6, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00, 0x0d, 0x9c, 0x80, 0x00,
+    0x00, 0x19, 0x36, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00, 0x19, 0xb3, 0x80, 0x00, 0x00, 0x0d, 0xd9,
+    0x80, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x06, 0x66, 0x80, 0x00, 0x00, 0x16, 0x4a, 0x80, 0x00, 0x07,
+    0xff, 0x00, 0x00, 0x13, 0x9c, 0x80, 0x00, 0x00, 0x13, 0xb6, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00,
+    0x0e, 0x73, 0x80, 0x00, 0x00, 0x18, 0xb5, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00, 0x0c, 0xcc, 0x80,
+    0x00, 0x00, 0x07, 0x4c, 0x80, 0x00, 0x03, 0xff, 0x80, 0x00, 0x11, 0xb3, 0x80, 0x00, 0x00, 0x0d,
+    0x73, 0x80, 0x00, 0x01, 0xff, 0xc0, 0x00, 0x17, 0x36, 0x00, 0x00, 0x00, 0x09, 0x9b, 0x40, 0x02,
+    0x00, 0x20, 0xf0, 0x00, 0x0c, 0xcd, 0x80, 0x00, 0x00, 0x06, 0x66, 0x40, 0x0f, 0x00, 0x00, 0x7c,
+    0x00, 0x1b, 0x59, 0x00, 0x00, 0x00, 0x0b, 0x6c, 0xc0, 0x39, 0x80, 0x00, 0x1e, 0x00, 0x23, 0x67,
+    0x00, 0x00, 0x00, 0x09, 0x99, 0xc1, 0xcc, 0x80, 0x00, 0x0f, 0x80, 0x1c, 0x99, 0x00, 0x00, 0x00,
+    0x06, 0xb3, 0x26, 0x73, 0x60, 0x00, 0x03, 0xc0, 0x56, 0xdb, 0x00, 0x00, 0x00, 0x06, 0x66, 0xbb,
+    0x9b, 0x40, 0x00, 0x01, 0xf0, 0x73, 0x66, 0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0xc0, 0x00,
+    0x00, 0x78, 0x09, 0xb2, 0x00, 0x00, 0x00, 0x01, 0x9b, 0x56, 0x65, 0x80, 0x00, 0x00, 0x1e, 0xfe,
+    0x9e, 0x00, 0x00, 0x00, 0x03, 0x39, 0xb3, 0x9b, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x64, 0x00, 0x00,
+    0x00, 0x02, 0x66, 0xac, 0xd9, 0x00, 0x00, 0x00, 0x03, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xd6,
+    0x67, 0x66, 0x00, 0x00, 0x00, 0x03, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x0d, 0x99, 0xd9, 0x36, 0x00,
+    0x00, 0x00, 0x05, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x33, 0x6d, 0x9a, 0xd8, 0x00, 0x00, 0x00, 0x0d,
+    0xff, 0xd8, 0x00, 0x00, 0x00, 0x36, 0x66, 0x66, 0xc8, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xd0, 0x00,
+    0x00, 0x00, 0x4d, 0x93, 0x6d, 0x30, 0x00, 0x00, 0x00, 0x33, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x19,
+    0xb9, 0x99, 0xb0, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x26, 0x66, 0xb6, 0x60,
+    0x00, 0x00, 0x00, 0x73, 0xff, 0x40, 0x00, 0x00, 0x00, 0x16, 0xd6, 0x66, 0xc0, 0x00, 0x00, 0x03,
+    0xce, 0x7e, 0xc0, 0x00, 0x00, 0x00, 0x19, 0x99, 0x99, 0x80, 0x00, 0x00, 0x0d, 0x99, 0x99, 0x80,
+    0x00, 0x00, 0x00, 0x03, 0x6c, 0xed, 0x80, 0x00, 0x00, 0x13, 0x35, 0xb3, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x67, 0x26, 0x00, 0x00, 0x00, 0x16, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0xb3,
+    0x00, 0x00, 0x00, 0x0c, 0xdb, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0xcc, 0x00, 0x00, 0x00,
+    0x09, 0x99, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x33, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x38, 0x00, 0x00, 0x00, 0x04, 0xe6, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x64, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x9c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+    0xb0, 0x00, 0x00, 0x00, 0x02, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x01, 0x98,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00};
-
-// ----- STATUS ICONS -----
-
-const unsigned char icon_wifi_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0,
-    0x00, 0x01, 0xff, 0xf8, 0x00, 0x07, 0xf0, 0xfe, 0x00, 0x0f, 0x00, 0x0f, 0x80, 0x3e, 0x00, 0x07, 0xc0, 0x38, 0x0f, 0x01, 0xc0, 0x30, 0x7f,
-    0xe0, 0xc0, 0x01, 0xff, 0xf8, 0x00, 0x03, 0xe0, 0x3c, 0x00, 0x07, 0x80, 0x1e, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00,
-    0x7f, 0xe0, 0x00, 0x00, 0xf9, 0xf0, 0x00, 0x00, 0xe0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_no_ble_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x80,
-    0x00, 0x00, 0x1f, 0xc0, 0x00, 0x0c, 0x1d, 0xe0, 0x00, 0x0f, 0x08, 0xf0, 0x00, 0x07, 0x80, 0x70, 0x00, 0x01, 0xe0, 0xe0, 0x00, 0x00, 0xf1,
-    0xc0, 0x00, 0x00, 0x3d, 0x80, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x1c, 0xf0, 0x00, 0x00,
-    0x3f, 0x78, 0x00, 0x00, 0x7f, 0x9e, 0x00, 0x01, 0xff, 0xef, 0x00, 0x01, 0xdd, 0xe3, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x1f, 0x80, 0x00,
-    0x00, 0x1f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_gps_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x80,
-    0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0xf0, 0x70, 0x00, 0x01, 0xc0, 0x38, 0x00, 0x03, 0x80, 0x1c, 0x00, 0x03, 0x0f, 0x0c, 0x00, 0x06, 0x1f,
-    0x8e, 0x00, 0x06, 0x3f, 0xc6, 0x00, 0x1e, 0x3f, 0xc7, 0x80, 0x1e, 0x3f, 0xc7, 0x80, 0x06, 0x3f, 0xc6, 0x00, 0x07, 0x1f, 0x86, 0x00, 0x03,
-    0x0f, 0x0c, 0x00, 0x03, 0x80, 0x1c, 0x00, 0x01, 0xc0, 0x38, 0x00, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x1f, 0x80, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_prayer_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x03, 0xff, 0xfc,
-    0x00, 0x07, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x07, 0xe7, 0x7e, 0x00, 0x07, 0xce, 0x1e, 0x00, 0x0f, 0x8f,
-    0x3f, 0x00, 0x1f, 0x8e, 0xbf, 0x80, 0x3f, 0x0f, 0xff, 0xc0, 0x3f, 0x0f, 0xef, 0xc0, 0x1f, 0x87, 0xdf, 0x80, 0x0f, 0x80, 0x1f, 0x00, 0x07,
-    0xc0, 0x3e, 0x00, 0x07, 0xe0, 0x7e, 0x00, 0x07, 0xf9, 0xfe, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xfc, 0x00,
-    0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_steps_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x7f,
-    0x00, 0x00, 0x00, 0x7f, 0x00, 0x01, 0x00, 0xff, 0x00, 0x07, 0xc0, 0xff, 0x00, 0x07, 0xe0, 0xff, 0x00, 0x0f, 0xe0, 0xff, 0x00, 0x0f, 0xf1,
-    0xfe, 0x00, 0x0f, 0xf0, 0xfe, 0x00, 0x0f, 0xf0, 0x7e, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf9, 0xf0, 0x00, 0x07, 0xf1, 0xfc, 0x00, 0x07,
-    0xf1, 0xf8, 0x00, 0x03, 0x81, 0xf8, 0x00, 0x00, 0x38, 0xf0, 0x00, 0x03, 0xf8, 0x40, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00,
-    0x00, 0xf8, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char icon_weather_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x06, 0x04,
-    0x00, 0x07, 0x00, 0x0e, 0x00, 0x03, 0x86, 0x1c, 0x00, 0x01, 0x1f, 0xc8, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0xf0, 0xe0, 0x00, 0x00, 0xe0,
-    0x70, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x3d, 0xc0, 0x33, 0xc0, 0x3c, 0xc0, 0x33, 0xc0, 0x00, 0x7e, 0x30, 0x00, 0x00, 0xfe, 0x70, 0x00, 0x01,
-    0xe0, 0xe0, 0x00, 0x00, 0xfc, 0xe0, 0x00, 0x00, 0xff, 0x08, 0x00, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x07, 0x0e, 0x00, 0x1f, 0xff, 0x04, 0x00,
-    0x1f, 0xfe, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// ----- BATTERY ICONS -----
-
-const unsigned char epd_bitmap_icon_battery_0_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x60, 0x00,
-    0x03, 0x40, 0x60, 0x00, 0x03, 0x60, 0x60, 0x00, 0x03, 0x60, 0x60, 0x00, 0x03, 0x60, 0x60, 0x00, 0x03, 0x60, 0x60, 0x00, 0x03, 0x40, 0x60,
-    0x00, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char epd_bitmap_icon_battery_20_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x67, 0x00, 0x03, 0x00, 0x6f, 0x00,
-    0x03, 0x40, 0x6f, 0x00, 0x03, 0x60, 0x6f, 0x00, 0x03, 0x60, 0x6f, 0x00, 0x03, 0x60, 0x6f, 0x00, 0x03, 0x60, 0x6f, 0x00, 0x03, 0x40, 0x67,
-    0x00, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char epd_bitmap_icon_battery_40_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x67, 0x60, 0x03, 0x00, 0x6f, 0x60,
-    0x03, 0x40, 0x6f, 0x60, 0x03, 0x60, 0x6f, 0x60, 0x03, 0x60, 0x6f, 0x60, 0x03, 0x60, 0x6f, 0x60, 0x03, 0x60, 0x6f, 0x60, 0x03, 0x40, 0x67,
-    0x60, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char epd_bitmap_icon_battery_60_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x67, 0x64, 0x03, 0x00, 0x6f, 0x6e,
-    0x03, 0x40, 0x6f, 0x6e, 0x03, 0x60, 0x6f, 0x6e, 0x03, 0x60, 0x6f, 0x6e, 0x03, 0x60, 0x6f, 0x6e, 0x03, 0x60, 0x6f, 0x6e, 0x03, 0x40, 0x67,
-    0x64, 0x03, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char epd_bitmap_icon_battery_80_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x67, 0x64, 0xc3, 0x00, 0x6f, 0x6e,
-    0xc3, 0x40, 0x6f, 0x6e, 0xc3, 0x60, 0x6f, 0x6e, 0xc3, 0x60, 0x6f, 0x6e, 0xc3, 0x60, 0x6f, 0x6e, 0xc3, 0x60, 0x6f, 0x6e, 0xc3, 0x40, 0x67,
-    0x64, 0xc3, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-const unsigned char epd_bitmap_icon_battery_100_small[] PROGMEM = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x60, 0x00, 0x03, 0x00, 0x67, 0x64, 0xdb, 0x00, 0x6f, 0x6e,
-    0xdb, 0x40, 0x6f, 0x6e, 0xdb, 0x60, 0x6f, 0x6e, 0xdb, 0x60, 0x6f, 0x6e, 0xdb, 0x60, 0x6f, 0x6e, 0xdb, 0x60, 0x6f, 0x6e, 0xdb, 0x40, 0x67,
-    0x64, 0xdb, 0x00, 0x60, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const Asset qpaperos_logo_100 = {qpaperos_logo_100_data, 100, 100, AssetEncoding::RAW, true, 1};
@@ -1,87 +1,211 @@
 #include "wakeup.h"
 
+// Draws the home screen as a display list over its background layer, which is only redrawn when what it shows changed
+static void drawHome(FrameDisplay *display, LayerState *homeLayer, DisplayListState *homeList, ESP32Time *rtc, DirtyRegions *dirty) {
+  timelineMark(Phase::LAYER);
+  uint32_t key = homeBackgroundKey();
+  if (!display->restoreLayer(homeLayer, key)) {
+    display->fillScreen(GxEPD_WHITE);
+    drawHomeBackground(display);
+    display->endLayer(homeLayer, key);
+  }
+  timelineMark(Phase::DRAW);
+  display->beginList(homeList, true);
+  drawHomeUI(display, rtc, calculateBatteryStatus());
+  display->endList(dirty);
+  timelineMark(Phase::HANDLER);
+}
+
+// The RTC time in epoch microseconds, read again if the second changed in between
+static int64_t epochUs(ESP32Time *rtc) {
+  long seconds, us;
+  do {
+    seconds = rtc->getEpoch();
+    us = rtc->getMicros();
+  } while (seconds != rtc->getEpoch());
+  return (int64_t)seconds * 1000000 + us;
+}
+
+// Puts today's energy over its copy in flash, or after the past days
+static void storeEnergy(const EnergyLog *energy, Preferences *preferences) {
+  bootRequire(Subsystem::PREFERENCES);
+  EnergyDay days[ENERGY_DAYS] = {};
+  preferences->getBytes("energy_days", days, sizeof(days));
+  energyStore(*energy, days);
+  preferences->putBytes("energy_days", days, sizeof(days));
+}
+
+// Brings the radio up to sync the time, it draws current from here until the wake ends
+static void beginWiFi(Preferences *preferences) {
+  bootRequire(Subsystem::WIFI);
+  energyOn(EnergyLoad::WIFI);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(preferences->getString("wifi_ssid"), preferences->getString("wifi_passwd"));
+}
+
 // Setup
 
-void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, LayerState *homeLayer, RefreshState *refreshState,
+                FrameDisplay *display, ESP32Time *rtc, Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_INIT");
 
+  bootRequire(Subsystem::PREFERENCES);
   rtc->setTime(preferences->getLong64("prev_time_unix", 0) + 15);
 
   display->fillScreen(GxEPD_WHITE);
+  timelineMark(Phase::REFRESH);
   display->update();
   delay(1000);
-  drawHomeUI(display, rtc, calculateBatteryStatus());
+  DirtyRegions dirty;
+  drawHome(display, homeLayer, homeList, rtc, &dirty);
+  timelineMark(Phase::REFRESH);
   display->update();
+  timelineMark(Phase::HANDLER);
+  recordRefresh(refreshState, RefreshMode::FULL, 0);
 
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(preferences->getString("wifi_ssid"), preferences->getString("wifi_passwd"));
+  beginWiFi(preferences);
   log(LogLevel::SUCCESS, "WiFi initiliazed");
 }
 
-void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, LayerState *homeLayer, RefreshState *refreshState,
+                 WakeSchedule *schedule, const DriftState *drift, EnergyLog *energy, FrameDisplay *display, ESP32Time *rtc,
+                 Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_LIGHT");
   setCpuFrequencyMhz(80);
-
-  drawHomeUI(display, rtc, calculateBatteryStatus());
-  display->update();
+  energyCpu(EnergyLoad::CPU_80);
+  // The radio stays off until the refresh is done, so the panel's BUSY time can be slept through
+  display->sleepWhileBusy(EPD_BUSY);
+
+  // The home screen widgets are redrawn as a display list, which only touches the ops that changed since the last wake
+  bool panelValid = homeList->valid;
+  // Only a wake the timer fired tells how long the way from the timer to here takes, the button or a reset don't
+  if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER)
+    schedule->wakeAtUs = 0;
+  scheduleWake(schedule, epochUs(rtc));
+  DirtyRegions dirty;
+  drawHome(display, homeLayer, homeList, rtc, &dirty);
+
+  // Refresh only the widgets that changed, with a periodic full refresh to clear ghosting
+  timelineMark(Phase::REFRESH);
+  uint32_t changedPixels = display->diff({0, 0, GxEPD_WIDTH, GxEPD_HEIGHT}).pixels;
+  RefreshMode refreshMode = decideRefresh(refreshState, changedPixels, panelValid, rtc->getMinute());
+  if (refreshMode == RefreshMode::FULL) {
+    display->update();
+  } else if (refreshMode == RefreshMode::PARTIAL) {
+    // Merge or split the dirty rects into whichever windows the panel refreshes fastest
+    RefreshPlan plan;
+    display->plan(dirty, refreshCost(refreshState), &plan);
+    if (BOOT_LOG_LIGHT_WAKES)
+      log(LogLevel::INFO, (String("Refresh plan: ") + String(plan.count) + " windows, ~" + String(plan.costUs / 1000) + " ms").c_str());
+    display->setCalibration(&refreshState->calibration);
+    for (uint8_t i = 0; i < plan.count; i++)
+      display->updateWindow(plan.windows[i].x, plan.windows[i].y, plan.windows[i].w, plan.windows[i].h, false);
+    display->setCalibration(nullptr);
+  }
+  recordRefresh(refreshState, refreshMode, changedPixels);
+  timelineMark(Phase::POWER_DOWN);
   display->powerDown();
+  display->sleepWhileBusy(-1);
+  timelineMark(Phase::HANDLER);
 
-  preferences->putLong64("prev_time_unix", rtc->getEpoch());
+  (*wakeupCount)++;
 
-  wakeupCount++;
+  // A cold boot starts from the last saved time, so it is saved every few minutes rather than only with the sync
+  if (*wakeupCount % TIME_SAVE_WAKES == 0) {
+    bootRequire(Subsystem::PREFERENCES);
+    preferences->putLong64("prev_time_unix", rtc->getEpoch());
+  }
 
-  if (*wakeupCount % 30 == 0) {
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(preferences->getString("wifi_ssid"), preferences->getString("wifi_passwd"));
+  // Every TIME_SYNC_WAKES wakes, or TIME_SYNC_FITTED_WAKES once the drift corrections can be relied on, sync the time
+  // over WiFi. The others never touch the radio.
+  if (*wakeupCount % (driftFitted(*drift) ? TIME_SYNC_FITTED_WAKES : TIME_SYNC_WAKES) == 0) {
+    bootRequire(Subsystem::PREFERENCES);
+    storeEnergy(energy, preferences);
+    beginWiFi(preferences);
     return;
   }
 
+  // The first wake of a day stores the day before, the flash copy is otherwise only updated along with the time sync
+  if (energyNewDay(*energy, epochUs(rtc)))
+    storeEnergy(energy, preferences);
+
   log(LogLevel::INFO, "Going to sleep...");
   digitalWrite(PWR_EN, LOW);
   esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_KEY, 0);
-  esp_sleep_enable_timer_wakeup(UPDATE_WAKEUP_TIMER_US);
+  // Woken up again right after the next minute boundary, so the new minute shows as soon as it starts
+  esp_sleep_enable_timer_wakeup(driftSleep(*drift, scheduleSleep(schedule, epochUs(rtc))));
+  timelineEnd();
+  energyEnd(epochUs(rtc));
   esp_deep_sleep_start();
 }
 
-void wakeupFull(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupFull(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, EnergyLog *energy, FrameDisplay *display,
+                ESP32Time *rtc, Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_FULL");
   setCpuFrequencyMhz(240);
+  energyCpu(EnergyLoad::CPU_240);
 
-  wakeupCount = 0;
+  *wakeupCount = 0;
+  homeList->valid = false;
 
   initApps();
   log(LogLevel::SUCCESS, "Apps initiliazed");
 
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(preferences->getString("wifi_ssid"), preferences->getString("wifi_passwd"));
+  bootRequire(Subsystem::PREFERENCES);
+  preferences->putLong64("prev_time_unix", rtc->getEpoch());
+  storeEnergy(energy, preferences);
+  beginWiFi(preferences);
 
   display->fillScreen(GxEPD_WHITE);
+  timelineMark(Phase::REFRESH);
   display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
+  timelineMark(Phase::HANDLER);
 }
 
 // Loop
 
-void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc) {
+void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, FrameDisplay *display, ESP32Time *rtc) {
   if (sleepTimer == 30) {
     *wakeupType = WakeupFlag::WAKEUP_LIGHT;
     esp_sleep_enable_timer_wakeup(1000000);
+    timelineEnd();
+    energyEnd(epochUs(rtc));
     esp_deep_sleep_start();
   }
 }
 
-void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc) {
+void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, WakeSchedule *schedule, const DriftState *drift, FrameDisplay *display,
+                     ESP32Time *rtc) {
   if (sleepTimer == 15) {
     digitalWrite(PWR_EN, LOW);
     esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_KEY, 0);
-    esp_sleep_enable_timer_wakeup(UPDATE_WAKEUP_TIMER_US - 15000000);
+    // Scheduled from the time WiFi may just have synced, whatever the 15 s awake took
+    esp_sleep_enable_timer_wakeup(driftSleep(*drift, scheduleSleep(schedule, epochUs(rtc))));
+    timelineEnd();
+    energyEnd(epochUs(rtc));
     esp_deep_sleep_start();
   }
 }
 
-void wakeupFullLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc, AwakeState awakeState) {
+void wakeupFullLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, DisplayListState *appsList, RefreshState *refreshState, FrameDisplay *display,
+                    ESP32Time *rtc, AwakeState awakeState) {
   if (awakeState == AwakeState::APPS_MENU) {
+    // Redrawn every loop, the display list keeps that down to the ops that changed
+    DirtyRegions dirty;
+    display->beginList(appsList);
     drawAppsListUI(display, rtc, calculateBatteryStatus());
-    display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
+    display->endList(&dirty);
+    // Only the windows around what changed are pushed, none at all while the menu stays the same. These aren't timed:
+    // at 240 MHz with the radio up and BUSY idled through rather than slept, they would skew the minute wake's fit.
+    RefreshPlan plan;
+    display->plan(dirty, refreshCost(refreshState), &plan);
+    // Every window ghosts like a minute wake's partial does, so it counts towards the next forced full refresh
+    for (uint8_t i = 0; i < plan.count; i++) {
+      const Rect &window = plan.windows[i];
+      uint32_t changedPixels = display->diff(window).pixels;
+      display->updateWindow(window.x, window.y, window.w, window.h, false);
+      recordRefresh(refreshState, RefreshMode::PARTIAL, changedPixels);
+    }
   } else {
     apps[currentAppIndex]->drawUI(display);
   }
@@ -89,6 +213,8 @@ void wakeupFullLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class
   if (sleepTimer == 15) {
     *wakeupType = WakeupFlag::WAKEUP_LIGHT;
     esp_sleep_enable_timer_wakeup(1000000);
+    timelineEnd();
+    energyEnd(epochUs(rtc));
     esp_deep_sleep_start();
   }
 }
\ No newline at end of file
@@ -9,16 +9,29 @@
 #include "apps.h"
 #include "home.h"
 #include "lib/battery.h"
+#include "lib/boot.h"
+#include "lib/display.h"
+#include "lib/drift.h"
+#include "lib/energy.h"
 #include "lib/log.h"
+#include "lib/refresh.h"
+#include "lib/schedule.h"
+#include "lib/timeline.h"
 #include "os_config.h"
 
 enum class WakeupFlag { WAKEUP_INIT, WAKEUP_FULL, WAKEUP_LIGHT };
 enum class AwakeState { APPS_MENU, IN_APP };
 
-void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
-void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
-void wakeupFull(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
+void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, LayerState *homeLayer, RefreshState *refreshState,
+                FrameDisplay *display, ESP32Time *rtc, Preferences *preferences);
+void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, LayerState *homeLayer, RefreshState *refreshState,
+                 WakeSchedule *schedule, const DriftState *drift, EnergyLog *energy, FrameDisplay *display, ESP32Time *rtc,
+                 Preferences *preferences);
+void wakeupFull(WakeupFlag *wakeupType, unsigned int *wakeupCount, DisplayListState *homeList, EnergyLog *energy, FrameDisplay *display,
+                ESP32Time *rtc, Preferences *preferences);
 
-void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc);
-void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc);
-void wakeupFullLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc, AwakeState awakeState);
+void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, FrameDisplay *display, ESP32Time *rtc);
+void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, WakeSchedule *schedule, const DriftState *drift, FrameDisplay *display,
+                     ESP32Time *rtc);
+void wakeupFullLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, DisplayListState *appsList, RefreshState *refreshState, FrameDisplay *display,
+                    ESP32Time *rtc, AwakeState awakeState);
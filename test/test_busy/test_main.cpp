@@ -0,0 +1,121 @@
+#include <unity.h>
+
+#include "GxIO/GxIO_SPI/GxIO_SPI.h"
+#include "esp_sleep.h"
+
+#include "lib/busy.h"
+#include "lib/display.h"
+#include "os_config.h"
+
+// BusyWait on its own, then through FrameDisplay's idle hook against the virtual panel holding BUSY
+
+#define TIMEOUT_US 5000000
+// Virtual time the host clock adds over a refresh, and the 1 ms polls either side of a sleep
+#define SLACK_US 50000
+
+uint8_t panelFrame[FRAME_BUFFER_SIZE];
+
+GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
+FrameDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
+
+void setUp() {
+  display.setBusyTime(0);
+  display.sleepWhileBusy(-1);
+  nativeResetSleepStats();
+}
+
+void tearDown() {}
+
+void test_waits_until_busy_is_seen() {
+  BusyWait wait(TIMEOUT_US);
+  wait.start(0);
+  TEST_ASSERT_TRUE(wait.poll(false, 100) == BusyAction::WAIT);
+  TEST_ASSERT_TRUE(wait.state() == BusyState::STARTED);
+  TEST_ASSERT_TRUE(wait.poll(true, 200) == BusyAction::SLEEP);
+  TEST_ASSERT_TRUE(wait.state() == BusyState::BUSY);
+  TEST_ASSERT_EQUAL_UINT32(TIMEOUT_US - 800, wait.sleepUs(1000));
+}
+
+void test_sums_every_busy_phase() {
+  BusyWait wait(TIMEOUT_US);
+  wait.start(0);
+  wait.poll(true, 1000);
+  TEST_ASSERT_TRUE(wait.poll(false, 3000) == BusyAction::WAIT);
+  TEST_ASSERT_TRUE(wait.state() == BusyState::DONE);
+  TEST_ASSERT_EQUAL_UINT32(0, wait.sleepUs(3000));
+  // The next command phase raises BUSY again, and the driver sees it drop before the next poll
+  TEST_ASSERT_TRUE(wait.poll(true, 4000) == BusyAction::SLEEP);
+  wait.stop(9000);
+  TEST_ASSERT_TRUE(wait.state() == BusyState::IDLE);
+  TEST_ASSERT_EQUAL_UINT32(7000, wait.busyUs());
+}
+
+void test_gives_up_after_timeout() {
+  BusyWait wait(TIMEOUT_US);
+  wait.start(0);
+  wait.poll(true, 1000);
+  TEST_ASSERT_TRUE(wait.poll(true, 1000 + TIMEOUT_US - 1) == BusyAction::SLEEP);
+  TEST_ASSERT_EQUAL_UINT32(1, wait.sleepUs(1000 + TIMEOUT_US - 1));
+  TEST_ASSERT_TRUE(wait.poll(true, 1000 + TIMEOUT_US) == BusyAction::WAIT);
+  TEST_ASSERT_TRUE(wait.state() == BusyState::TIMEOUT);
+  TEST_ASSERT_EQUAL_UINT32(TIMEOUT_US, wait.busyUs());
+  // Left to the driver from here on, however long BUSY stays up
+  TEST_ASSERT_TRUE(wait.poll(true, 1000 + 2 * TIMEOUT_US) == BusyAction::WAIT);
+  TEST_ASSERT_EQUAL_UINT32(0, wait.sleepUs(1000 + 2 * TIMEOUT_US));
+}
+
+void test_refresh_without_hook_stays_awake() {
+  display.setBusyTime(1500000);
+  unsigned long start = micros();
+  display.update();
+  TEST_ASSERT_EQUAL_UINT32(0, nativeSleepStats().lightSleeps);
+  TEST_ASSERT_UINT32_WITHIN(SLACK_US, 1500000, micros() - start);
+}
+
+void test_refresh_sleeps_through_busy() {
+  display.setBusyTime(1500000);
+  display.sleepWhileBusy(EPD_BUSY);
+  unsigned long start = micros();
+  display.update();
+  // One sleep from the first poll with BUSY up until it drops
+  TEST_ASSERT_EQUAL_UINT32(1, nativeSleepStats().lightSleeps);
+  TEST_ASSERT_UINT32_WITHIN(SLACK_US, 1500000, nativeSleepStats().lightSleptUs);
+  TEST_ASSERT_UINT32_WITHIN(SLACK_US, 1500000, micros() - start);
+}
+
+void test_refresh_stops_sleeping_after_timeout() {
+  display.setBusyTime(8000000);
+  display.sleepWhileBusy(EPD_BUSY);
+  unsigned long start = micros();
+  display.update();
+  // Woken by the timer at the timeout, the driver then polls until BUSY drops
+  TEST_ASSERT_EQUAL_UINT32(1, nativeSleepStats().lightSleeps);
+  TEST_ASSERT_UINT32_WITHIN(SLACK_US, TIMEOUT_US, nativeSleepStats().lightSleptUs);
+  TEST_ASSERT_UINT32_WITHIN(SLACK_US, 8000000, micros() - start);
+
+  // The next refresh starts over
+  nativeResetSleepStats();
+  display.setBusyTime(1000000);
+  display.update();
+  TEST_ASSERT_EQUAL_UINT32(1, nativeSleepStats().lightSleeps);
+}
+
+void test_no_sleep_after_hook_removed() {
+  display.setBusyTime(1000000);
+  display.sleepWhileBusy(EPD_BUSY);
+  display.sleepWhileBusy(-1);
+  display.update();
+  TEST_ASSERT_EQUAL_UINT32(0, nativeSleepStats().lightSleeps);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_waits_until_busy_is_seen);
+  RUN_TEST(test_sums_every_busy_phase);
+  RUN_TEST(test_gives_up_after_timeout);
+  RUN_TEST(test_refresh_without_hook_stays_awake);
+  RUN_TEST(test_refresh_sleeps_through_busy);
+  RUN_TEST(test_refresh_stops_sleeping_after_timeout);
+  RUN_TEST(test_no_sleep_after_hook_removed);
+  return UNITY_END();
+}
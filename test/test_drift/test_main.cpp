@@ -0,0 +1,121 @@
+#include <unity.h>
+
+#include "lib/drift.h"
+
+// Times are a fake epoch in microseconds
+#define EPOCH_US  1700000000000000LL
+#define HOUR_US   3600000000LL
+#define MAX_PPB   (DRIFT_MAX_PPM * 1000)
+
+static DriftState drift;
+
+void setUp() { drift = {}; }
+
+void tearDown() {}
+
+void test_first_sync_only_sets_the_clock() {
+  driftSync(&drift, EPOCH_US + 5000, EPOCH_US);
+  TEST_ASSERT_TRUE(drift.syncUs == EPOCH_US);
+  TEST_ASSERT_TRUE(drift.correctedUs == EPOCH_US);
+  TEST_ASSERT_EQUAL_UINT8(0, drift.count);
+  TEST_ASSERT_EQUAL_INT32(0, drift.ppb);
+  TEST_ASSERT_EQUAL_INT32(0, driftCorrection(&drift, EPOCH_US + HOUR_US));
+}
+
+void test_fits_the_gain_between_syncs() {
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  // 36 ms fast after an hour is 10 ppm
+  driftSync(&drift, EPOCH_US + HOUR_US + 36000, EPOCH_US + HOUR_US);
+  TEST_ASSERT_EQUAL_UINT8(1, drift.count);
+  TEST_ASSERT_EQUAL_UINT32(3600, drift.samples[0].spanS);
+  TEST_ASSERT_EQUAL_INT32(36000, drift.samples[0].gainUs);
+  TEST_ASSERT_EQUAL_INT32(10000, drift.ppb);
+}
+
+void test_fit_is_least_squares_through_the_origin() {
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  driftSync(&drift, EPOCH_US + HOUR_US + 36000, EPOCH_US + HOUR_US);
+  // No gain over the next two hours, which weigh in four times as much
+  driftSync(&drift, EPOCH_US + 3 * HOUR_US, EPOCH_US + 3 * HOUR_US);
+  TEST_ASSERT_EQUAL_UINT8(2, drift.count);
+  TEST_ASSERT_EQUAL_INT32(2000, drift.ppb);
+}
+
+void test_corrections_are_taken_out_of_the_next_sample() {
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  driftSync(&drift, EPOCH_US + HOUR_US + 36000, EPOCH_US + HOUR_US);
+
+  // 10 minutes later the clock is 6 ms fast, which the correction takes back
+  int64_t localUs = EPOCH_US + HOUR_US + 600000000 + 6000;
+  TEST_ASSERT_EQUAL_INT32(-6000, driftCorrection(&drift, localUs));
+  TEST_ASSERT_TRUE(drift.correctedUs == localUs - 6000);
+  TEST_ASSERT_TRUE(drift.appliedUs == -6000);
+
+  // The clock kept gaining at the same rate, only what was left of it shows at the sync
+  driftSync(&drift, EPOCH_US + 2 * HOUR_US + 30000, EPOCH_US + 2 * HOUR_US);
+  TEST_ASSERT_EQUAL_UINT8(2, drift.count);
+  TEST_ASSERT_EQUAL_INT32(36000, drift.samples[1].gainUs);
+  TEST_ASSERT_EQUAL_INT32(10000, drift.ppb);
+  TEST_ASSERT_TRUE(drift.appliedUs == 0);
+}
+
+void test_short_spans_and_large_gains_are_not_kept() {
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  driftSync(&drift, EPOCH_US + (DRIFT_MIN_SPAN_S - 1) * 1000000LL + 1000, EPOCH_US + (DRIFT_MIN_SPAN_S - 1) * 1000000LL);
+  TEST_ASSERT_EQUAL_UINT8(0, drift.count);
+
+  // Faster than DRIFT_MAX_PPM, the clock was set in between
+  int64_t syncUs = drift.syncUs;
+  driftSync(&drift, syncUs + HOUR_US + 3600LL * MAX_PPB / 1000 + 1, syncUs + HOUR_US);
+  TEST_ASSERT_EQUAL_UINT8(0, drift.count);
+  TEST_ASSERT_TRUE(drift.syncUs == syncUs + HOUR_US);
+}
+
+void test_corrections_add_up_past_32_bits() {
+  // Syncs failing for months at the fastest drift, every wake an hour after the last correction
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  drift.ppb = MAX_PPB;
+  int64_t localUs = EPOCH_US, correctionUs = HOUR_US * MAX_PPB / 1000000000;
+  for (int hour = 0; hour < 2000; hour++) {
+    localUs += HOUR_US;
+    TEST_ASSERT_EQUAL_INT32(-correctionUs, driftCorrection(&drift, localUs));
+    localUs -= correctionUs;
+  }
+  TEST_ASSERT_TRUE(drift.appliedUs == -2000 * correctionUs);
+
+  // A gain that large doesn't fit a sample, the sync only sets the clock
+  driftSync(&drift, localUs, localUs);
+  TEST_ASSERT_EQUAL_UINT8(0, drift.count);
+  TEST_ASSERT_TRUE(drift.appliedUs == 0);
+  TEST_ASSERT_TRUE(drift.syncUs == localUs);
+}
+
+void test_sleep_is_stretched_by_the_drift() {
+  TEST_ASSERT_TRUE(driftSleep(drift, 60000000) == 60000000);
+  drift.ppb = 10000;
+  TEST_ASSERT_TRUE(driftSleep(drift, 60000000) == 60000600);
+  drift.ppb = -10000;
+  TEST_ASSERT_TRUE(driftSleep(drift, 60000000) == 59999400);
+}
+
+void test_fitted_after_enough_syncs() {
+  driftSync(&drift, EPOCH_US, EPOCH_US);
+  for (uint8_t i = 1; i <= DRIFT_MIN_SAMPLES; i++) {
+    TEST_ASSERT_FALSE(driftFitted(drift));
+    driftSync(&drift, EPOCH_US + i * HOUR_US, EPOCH_US + i * HOUR_US);
+  }
+  TEST_ASSERT_TRUE(driftFitted(drift));
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_first_sync_only_sets_the_clock);
+  RUN_TEST(test_fits_the_gain_between_syncs);
+  RUN_TEST(test_fit_is_least_squares_through_the_origin);
+  RUN_TEST(test_corrections_are_taken_out_of_the_next_sample);
+  RUN_TEST(test_short_spans_and_large_gains_are_not_kept);
+  RUN_TEST(test_corrections_add_up_past_32_bits);
+  RUN_TEST(test_sleep_is_stretched_by_the_drift);
+  RUN_TEST(test_fitted_after_enough_syncs);
+  return UNITY_END();
+}
@@ -0,0 +1,110 @@
+#include <string.h>
+#include <unity.h>
+
+#include "lib/framediff.h"
+
+#define WIDTH     200
+#define HEIGHT    200
+#define ROW_BYTES ((WIDTH + 7) / 8)
+
+static uint8_t prev[ROW_BYTES * HEIGHT];
+static uint8_t next[ROW_BYTES * HEIGHT];
+
+static const Rect fullFrame = {0, 0, WIDTH, HEIGHT};
+
+static void flip(uint8_t *frame, int16_t x, int16_t y, int16_t width = WIDTH) { frame[y * ((width + 7) / 8) + x / 8] ^= 0x80 >> (x & 7); }
+
+static void assertRect(const Rect &expected, const Rect &actual) {
+  TEST_ASSERT_EQUAL_INT(expected.x, actual.x);
+  TEST_ASSERT_EQUAL_INT(expected.y, actual.y);
+  TEST_ASSERT_EQUAL_INT(expected.w, actual.w);
+  TEST_ASSERT_EQUAL_INT(expected.h, actual.h);
+}
+
+void setUp() {
+  memset(prev, 0xFF, sizeof(prev));
+  memset(next, 0xFF, sizeof(next));
+}
+
+void tearDown() {}
+
+void test_identical_frames() {
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, fullFrame);
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+  TEST_ASSERT_TRUE(rectIsEmpty(diff.bounds));
+}
+
+void test_single_pixel() {
+  flip(next, 13, 7);
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, fullFrame);
+  TEST_ASSERT_EQUAL_UINT32(1, diff.pixels);
+  assertRect({8, 7, 8, 1}, diff.bounds);
+}
+
+void test_pixels_on_both_sides_of_a_byte_edge() {
+  flip(next, 7, 20);
+  flip(next, 8, 30);
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, fullFrame);
+  TEST_ASSERT_EQUAL_UINT32(2, diff.pixels);
+  assertRect({0, 20, 16, 11}, diff.bounds);
+}
+
+void test_last_byte_of_the_row() {
+  flip(next, WIDTH - 1, HEIGHT - 1);
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, fullFrame);
+  TEST_ASSERT_EQUAL_UINT32(1, diff.pixels);
+  assertRect({WIDTH - 8, HEIGHT - 1, 8, 1}, diff.bounds);
+}
+
+void test_window_masks_partial_bytes() {
+  // x 10..13 shares its bytes with 9 and 14, which are outside the window
+  flip(next, 9, 5);
+  flip(next, 14, 5);
+  Rect window = {10, 0, 4, HEIGHT};
+  TEST_ASSERT_EQUAL_UINT32(0, frameDiff(prev, next, WIDTH, HEIGHT, window).pixels);
+
+  flip(next, 12, 6);
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, window);
+  TEST_ASSERT_EQUAL_UINT32(1, diff.pixels);
+  assertRect({8, 6, 8, 1}, diff.bounds);
+}
+
+void test_window_outside_the_frame() {
+  flip(next, 0, 0);
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, {WIDTH, 0, 10, 10});
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+  TEST_ASSERT_TRUE(rectIsEmpty(diff.bounds));
+}
+
+void test_row_padding_is_ignored() {
+  // 12 pixels wide, the last 4 bits of every row are padding
+  const int16_t width = 12;
+  flip(next, 13, 2, width);
+  FrameDiff diff = frameDiff(prev, next, width, 4, {0, 0, width, 4});
+  TEST_ASSERT_EQUAL_UINT32(0, diff.pixels);
+
+  flip(next, 11, 3, width);
+  diff = frameDiff(prev, next, width, 4, {0, 0, width, 4});
+  TEST_ASSERT_EQUAL_UINT32(1, diff.pixels);
+  assertRect({8, 3, 4, 1}, diff.bounds);
+}
+
+void test_full_frame_change() {
+  memset(next, 0x00, sizeof(next));
+  FrameDiff diff = frameDiff(prev, next, WIDTH, HEIGHT, fullFrame);
+  TEST_ASSERT_EQUAL_UINT32(WIDTH * HEIGHT, diff.pixels);
+  assertRect(fullFrame, diff.bounds);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_identical_frames);
+  RUN_TEST(test_single_pixel);
+  RUN_TEST(test_pixels_on_both_sides_of_a_byte_edge);
+  RUN_TEST(test_last_byte_of_the_row);
+  RUN_TEST(test_window_masks_partial_bytes);
+  RUN_TEST(test_window_outside_the_frame);
+  RUN_TEST(test_row_padding_is_ignored);
+  RUN_TEST(test_full_frame_change);
+  return UNITY_END();
+}
@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <string>
+#include <unity.h>
+
+#include "ESP32Time.h"
+#include "GxIO/GxIO_SPI/GxIO_SPI.h"
+
+#include "home.h"
+#include "lib/battery.h"
+#include "lib/display.h"
+#include "os_config.h"
+
+// Draws the home screen at the fixed time of [env:native] and compares what the panel shows with home.pbm next to this
+// file. On a mismatch the frame is written to home_actual.pbm beside it; when the change is intended, that file
+// becomes the new golden.
+
+uint8_t panelFrame[FRAME_BUFFER_SIZE];
+
+GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
+FrameDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
+
+ESP32Time rtc;
+
+static std::string testDir() {
+  std::string file = __FILE__;
+  size_t slash = file.find_last_of('/');
+  return slash == std::string::npos ? "." : file.substr(0, slash);
+}
+
+static std::string readFile(const std::string &path) {
+  std::string contents;
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == nullptr)
+    return contents;
+  char buffer[512];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    contents.append(buffer, read);
+  fclose(file);
+  return contents;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_home_matches_golden() {
+  rtc.setTime(0, 34, 12, 3, 6, 2024);
+  display.init();
+  display.setRotation(1);
+  display.fillScreen(GxEPD_WHITE);
+  drawHomeBackground(&display);
+  drawHomeUI(&display, &rtc, calculateBatteryStatus());
+  display.update();
+
+  std::string golden = readFile(testDir() + "/home.pbm");
+  TEST_ASSERT_TRUE(golden.size() > 0);
+
+  std::string actualPath = testDir() + "/home_actual.pbm";
+  TEST_ASSERT_TRUE(display.writePBM(actualPath.c_str()));
+  std::string actual = readFile(actualPath);
+  bool same = actual == golden;
+  if (same)
+    remove(actualPath.c_str());
+  TEST_ASSERT_EQUAL_UINT32(golden.size(), actual.size());
+  TEST_ASSERT_TRUE(same);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_home_matches_golden);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+#include <string.h>
+#include <unity.h>
+
+#include "lib/refreshplan.h"
+
+#define WIDTH     200
+#define HEIGHT    200
+#define ROW_BYTES ((WIDTH + 7) / 8)
+
+static uint8_t prev[ROW_BYTES * HEIGHT];
+static uint8_t next[ROW_BYTES * HEIGHT];
+
+// Setup dominated: every window costs 10 ms, bytes are nearly free
+static const RefreshCost fixedCost = {9000, 1000, 1000};
+// Transfer dominated: a window costs 10 us, every byte 100 us
+static const RefreshCost byteCost = {10, 100000, 0};
+
+static void flip(int16_t x, int16_t y) { next[y * ROW_BYTES + x / 8] ^= 0x80 >> (x & 7); }
+
+static bool covered(const RefreshPlan &plan, int16_t x, int16_t y) {
+  for (uint8_t i = 0; i < plan.count; i++) {
+    const Rect &w = plan.windows[i];
+    if (x >= w.x && x < w.x + w.w && y >= w.y && y < w.y + w.h)
+      return true;
+  }
+  return false;
+}
+
+// Every pixel that differs lies inside a window of the plan
+static void assertCoversChanges(const RefreshPlan &plan) {
+  for (int16_t y = 0; y < HEIGHT; y++)
+    for (int16_t x = 0; x < WIDTH; x++)
+      if ((prev[y * ROW_BYTES + x / 8] ^ next[y * ROW_BYTES + x / 8]) & (0x80 >> (x & 7)))
+        TEST_ASSERT_TRUE(covered(plan, x, y));
+}
+
+static void assertRect(const Rect &expected, const Rect &actual) {
+  TEST_ASSERT_EQUAL_INT(expected.x, actual.x);
+  TEST_ASSERT_EQUAL_INT(expected.y, actual.y);
+  TEST_ASSERT_EQUAL_INT(expected.w, actual.w);
+  TEST_ASSERT_EQUAL_INT(expected.h, actual.h);
+}
+
+void setUp() {
+  memset(prev, 0xFF, sizeof(prev));
+  memset(next, 0xFF, sizeof(next));
+}
+
+void tearDown() {}
+
+void test_window_cost() {
+  // Columns 10..30 touch bytes 1..3 of the row
+  Rect window = {10, 0, 21, 2};
+  TEST_ASSERT_EQUAL_UINT32(6, windowBytes(window));
+  TEST_ASSERT_EQUAL_UINT32(10006, windowCost(window, fixedCost));
+  TEST_ASSERT_EQUAL_UINT32(610, windowCost(window, byteCost));
+  TEST_ASSERT_EQUAL_UINT32(0, windowBytes({0, 0, 0, 0}));
+}
+
+void test_nothing_changed() {
+  DirtyRegions dirty;
+  dirty.add({0, 0, 50, 50});
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, fixedCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(0, plan.count);
+  TEST_ASSERT_EQUAL_UINT32(0, plan.costUs);
+}
+
+void test_merges_when_setup_dominates() {
+  flip(10, 10);
+  flip(30, 10);
+  DirtyRegions dirty;
+  dirty.add({8, 8, 8, 8});
+  dirty.add({24, 8, 16, 8});
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, fixedCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(1, plan.count);
+  assertRect({8, 10, 24, 1}, plan.windows[0]);
+  TEST_ASSERT_EQUAL_UINT32(10003, plan.costUs);
+}
+
+void test_splits_when_bytes_dominate() {
+  flip(0, 0);
+  flip(199, 199);
+  DirtyRegions dirty;
+  dirty.add({0, 0, 8, 8});
+  dirty.add({192, 192, 8, 8});
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, byteCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(2, plan.count);
+  TEST_ASSERT_EQUAL_UINT32(220, plan.costUs);
+  assertCoversChanges(plan);
+}
+
+void test_splits_one_dirty_rect_into_bands() {
+  // Two changes far apart inside a single full panel dirty rect
+  flip(0, 0);
+  flip(199, 199);
+  DirtyRegions dirty;
+  dirty.add({0, 0, WIDTH, HEIGHT});
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, byteCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(2, plan.count);
+  TEST_ASSERT_EQUAL_UINT32(220, plan.costUs);
+  assertCoversChanges(plan);
+
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, fixedCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(1, plan.count);
+  assertRect({0, 0, WIDTH, HEIGHT}, plan.windows[0]);
+}
+
+void test_keeps_within_max_windows() {
+  // More separate changes than a plan holds, each worth its own window on cost alone
+  DirtyRegions dirty;
+  for (int16_t i = 0; i < 12; i++) {
+    flip(i * 16, i * 16);
+    dirty.add({(int16_t)(i * 16), (int16_t)(i * 16), 1, 1});
+  }
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, byteCost, &plan);
+  TEST_ASSERT_TRUE(plan.count <= REFRESH_PLAN_MAX_WINDOWS);
+  TEST_ASSERT_TRUE(plan.count > 1);
+  assertCoversChanges(plan);
+}
+
+void test_ignores_changes_outside_dirty() {
+  flip(100, 100);
+  flip(10, 10);
+  DirtyRegions dirty;
+  dirty.add({0, 0, 16, 16});
+  RefreshPlan plan;
+  planRefresh(prev, next, WIDTH, HEIGHT, dirty, fixedCost, &plan);
+  TEST_ASSERT_EQUAL_UINT8(1, plan.count);
+  assertRect({8, 10, 8, 1}, plan.windows[0]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_window_cost);
+  RUN_TEST(test_nothing_changed);
+  RUN_TEST(test_merges_when_setup_dominates);
+  RUN_TEST(test_splits_when_bytes_dominate);
+  RUN_TEST(test_splits_one_dirty_rect_into_bands);
+  RUN_TEST(test_keeps_within_max_windows);
+  RUN_TEST(test_ignores_changes_outside_dirty);
+  return UNITY_END();
+}
@@ -0,0 +1,196 @@
+#include <string.h>
+#include <unity.h>
+
+#include "GxIO/GxIO_SPI/GxIO_SPI.h"
+
+#include "bench/Outfit_80036pt7b_raw.h"
+#include "lib/display.h"
+#include "lib/renderer.h"
+#include "os_config.h"
+#include "resources/app_icons.h"
+#include "resources/fonts/Outfit_60011pt7b.h"
+#include "resources/fonts/Outfit_80036pt7b.h"
+#include "resources/icons.h"
+
+// FrameRenderer draws every call into its own frame, FrameDisplay through Adafruit_GFX into the panel's, both at the
+// rotation the firmware uses. The two frames have to come out the same, pixel for pixel.
+
+uint8_t panelFrame[FRAME_BUFFER_SIZE];
+
+GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
+FrameDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY, panelFrame);
+
+static uint8_t rendererFrame[FRAME_BUFFER_SIZE];
+static FrameRenderer<GxEPD_WIDTH, GxEPD_HEIGHT, 1> renderer(rendererFrame);
+
+static void assertSameFrame() { TEST_ASSERT_EQUAL_MEMORY(display.getBuffer(), rendererFrame, FRAME_BUFFER_SIZE); }
+
+void setUp() {
+  display.setRotation(1);
+  display.setTextWrap(true);
+  display.setTextSize(1);
+  display.fillScreen(GxEPD_WHITE);
+  renderer.setTextWrap(true);
+  renderer.setTextSize(1);
+  renderer.fillScreen(GxEPD_WHITE);
+}
+
+void tearDown() {}
+
+void test_rects() {
+  // Byte aligned and not, and clipped on every side
+  const int16_t rects[][4] = {{0, 0, 200, 200}, {8, 16, 64, 32}, {3, 5, 7, 131}, {-10, 150, 40, 80}, {180, -5, 50, 20}, {99, 99, 1, 1}};
+  uint16_t color = GxEPD_BLACK;
+  for (const auto &r : rects) {
+    display.fillRect(r[0], r[1], r[2], r[3], color);
+    renderer.fillRect(r[0], r[1], r[2], r[3], color);
+    display.drawRect(r[0] + 2, r[1] + 2, r[2], r[3], GxEPD_WHITE);
+    renderer.drawRect(r[0] + 2, r[1] + 2, r[2], r[3], GxEPD_WHITE);
+    display.drawFastHLine(r[0], r[1] + 1, r[2], color);
+    renderer.drawFastHLine(r[0], r[1] + 1, r[2], color);
+    display.drawFastVLine(r[0] + 1, r[1], r[3], color);
+    renderer.drawFastVLine(r[0] + 1, r[1], r[3], color);
+    color = color == GxEPD_BLACK ? GxEPD_WHITE : GxEPD_BLACK;
+  }
+  assertSameFrame();
+}
+
+void test_round_rects() {
+  // Radii up to past half the shorter side, which gets clamped
+  const int16_t rects[][5] = {{45, 45, 110, 110, 11}, {10, 10, 60, 30, 0}, {5, 120, 80, 50, 40}, {150, 150, 70, 70, 20}, {-20, 60, 50, 30, 8}};
+  for (const auto &r : rects) {
+    display.drawRoundRect(r[0], r[1], r[2], r[3], r[4], GxEPD_BLACK);
+    renderer.drawRoundRect(r[0], r[1], r[2], r[3], r[4], GxEPD_BLACK);
+  }
+  assertSameFrame();
+
+  for (const auto &r : rects) {
+    display.fillRoundRect(r[0] + 3, r[1] + 3, r[2] - 6, r[3] - 6, r[4], GxEPD_BLACK);
+    renderer.fillRoundRect(r[0] + 3, r[1] + 3, r[2] - 6, r[3] - 6, r[4], GxEPD_BLACK);
+  }
+  assertSameFrame();
+}
+
+void test_circles() {
+  const int16_t circles[][3] = {{100, 100, 60}, {20, 20, 5}, {190, 30, 25}, {50, 180, 40}, {100, 100, 0}};
+  for (const auto &c : circles) {
+    display.fillCircle(c[0], c[1], c[2], GxEPD_BLACK);
+    renderer.fillCircle(c[0], c[1], c[2], GxEPD_BLACK);
+    display.drawCircle(c[0], c[1], c[2] / 2, GxEPD_WHITE);
+    renderer.drawCircle(c[0], c[1], c[2] / 2, GxEPD_WHITE);
+  }
+  assertSameFrame();
+}
+
+void test_bitmaps() {
+  // 28 wide fits one mask per row, 100 wide takes four; both unaligned and hanging off the edges
+  const int16_t at[][2] = {{86, 86}, {3, 7}, {-9, 60}, {185, 190}, {60, -20}};
+  for (const auto &p : at) {
+    display.drawBitmap(p[0], p[1], icon_wifi_small.data, 28, 28, GxEPD_BLACK);
+    renderer.drawBitmap(p[0], p[1], icon_wifi_small.data, 28, 28, GxEPD_BLACK);
+  }
+  assertSameFrame();
+
+  display.fillRect(0, 0, 200, 100, GxEPD_BLACK);
+  renderer.fillRect(0, 0, 200, 100, GxEPD_BLACK);
+  for (const auto &p : at) {
+    display.drawBitmap(p[0] + 13, p[1] + 5, qpaperos_logo_100.data, 100, 100, GxEPD_WHITE, GxEPD_BLACK);
+    renderer.drawBitmap(p[0] + 13, p[1] + 5, qpaperos_logo_100.data, 100, 100, GxEPD_WHITE, GxEPD_BLACK);
+  }
+  assertSameFrame();
+}
+
+void test_assets() {
+  // RAW and RLE, stored for the panel's rotation
+  const Asset *assets[] = {&icon_wifi_small, &icon_battery_20_small, &icon_app_about, &qpaperos_logo_100};
+  int16_t x = -5;
+  for (const Asset *asset : assets) {
+    drawAsset(&display, x, 170 - x, *asset, GxEPD_BLACK);
+    renderer.drawAsset(x, 170 - x, *asset, GxEPD_BLACK);
+    x += 47;
+  }
+  assertSameFrame();
+}
+
+void test_text() {
+  // Upright raw glyphs, and glyphs stored RLE or raw for the panel's rotation
+  const GFXfont *fonts[] = {&Outfit_60011pt7b, &Outfit_80036pt7b, &Outfit_80036pt7bRaw};
+  const char *texts[] = {"Mon, June 3", "12:34", "90:87"};
+  int16_t y = 30;
+  for (uint8_t i = 0; i < 3; i++) {
+    display.setFont(fonts[i]);
+    renderer.setFont(fonts[i]);
+    display.setTextColor(GxEPD_BLACK);
+    renderer.setTextColor(GxEPD_BLACK);
+    display.setCursor(7 + i, y);
+    renderer.setCursor(7 + i, y);
+    display.print(texts[i]);
+    renderer.print(texts[i]);
+    y += 70;
+  }
+  assertSameFrame();
+}
+
+void test_text_size_and_wrap() {
+  display.setFont(&Outfit_60011pt7b);
+  renderer.setFont(&Outfit_60011pt7b);
+  display.setTextColor(GxEPD_BLACK);
+  renderer.setTextColor(GxEPD_BLACK);
+  display.setTextSize(2);
+  renderer.setTextSize(2);
+  display.setCursor(150, 40);
+  renderer.setCursor(150, 40);
+  display.print("Wraps\nand breaks");
+  renderer.print("Wraps\nand breaks");
+  TEST_ASSERT_EQUAL_INT16(display.getCursorX(), renderer.getCursorX());
+  TEST_ASSERT_EQUAL_INT16(display.getCursorY(), renderer.getCursorY());
+  assertSameFrame();
+
+  display.setTextSize(1);
+  renderer.setTextSize(1);
+  display.setFont(&Outfit_80036pt7b);
+  renderer.setFont(&Outfit_80036pt7b);
+  display.setTextWrap(false);
+  renderer.setTextWrap(false);
+  display.setCursor(120, 190);
+  renderer.setCursor(120, 190);
+  display.print("56:78");
+  renderer.print("56:78");
+  assertSameFrame();
+}
+
+void test_text_bounds() {
+  const GFXfont *fonts[] = {&Outfit_60011pt7b, &Outfit_80036pt7b};
+  const char *texts[] = {"Mon, June 3", "12:34", "a long line that wraps around", "two\nlines"};
+  for (const GFXfont *font : fonts) {
+    display.setFont(font);
+    renderer.setFont(font);
+    for (uint8_t size = 1; size <= 2; size++) {
+      display.setTextSize(size);
+      renderer.setTextSize(size);
+      for (const char *text : texts) {
+        int16_t x1, y1, x2, y2;
+        uint16_t w1, h1, w2, h2;
+        display.getTextBounds(text, 10, 125, &x1, &y1, &w1, &h1);
+        renderer.getTextBounds(text, 10, 125, &x2, &y2, &w2, &h2);
+        TEST_ASSERT_EQUAL_INT16(x1, x2);
+        TEST_ASSERT_EQUAL_INT16(y1, y2);
+        TEST_ASSERT_EQUAL_UINT16(w1, w2);
+        TEST_ASSERT_EQUAL_UINT16(h1, h2);
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_rects);
+  RUN_TEST(test_round_rects);
+  RUN_TEST(test_circles);
+  RUN_TEST(test_bitmaps);
+  RUN_TEST(test_assets);
+  RUN_TEST(test_text);
+  RUN_TEST(test_text_size_and_wrap);
+  RUN_TEST(test_text_bounds);
+  return UNITY_END();
+}
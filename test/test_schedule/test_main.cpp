@@ -0,0 +1,111 @@
+#include <unity.h>
+
+#include "lib/schedule.h"
+
+// A fake epoch in microseconds, on a minute boundary
+#define PERIOD_US ((int64_t)UPDATE_WAKEUP_TIMER_US)
+#define EPOCH_US  (28333334 * PERIOD_US)
+
+static WakeSchedule schedule;
+
+void setUp() { schedule = {}; }
+
+void tearDown() {}
+
+void test_sleeps_until_the_next_boundary() {
+  int64_t nowUs = EPOCH_US + 10000000;
+  uint64_t sleepUs = scheduleSleep(&schedule, nowUs);
+  // Due SCHEDULE_MARGIN_US after the boundary, less the overhead assumed until one is measured
+  int64_t wakeAtUs = EPOCH_US + PERIOD_US + SCHEDULE_MARGIN_US - SCHEDULE_OVERHEAD_US;
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == wakeAtUs);
+  TEST_ASSERT_TRUE(sleepUs == (uint64_t)(wakeAtUs - nowUs));
+  TEST_ASSERT_EQUAL_INT64(0, (schedule.wakeAtUs + SCHEDULE_OVERHEAD_US - SCHEDULE_MARGIN_US) % PERIOD_US);
+}
+
+void test_on_a_boundary_sleeps_until_the_next_one() {
+  scheduleSleep(&schedule, EPOCH_US);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == EPOCH_US + PERIOD_US + SCHEDULE_MARGIN_US - SCHEDULE_OVERHEAD_US);
+}
+
+void test_adds_twice_the_jitter() {
+  schedule.overheadUs = 300000;
+  schedule.jitterUs = 10000;
+  scheduleSleep(&schedule, EPOCH_US + 10000000);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == EPOCH_US + PERIOD_US + SCHEDULE_MARGIN_US + 2 * 10000 - 300000);
+}
+
+void test_a_boundary_too_close_gets_the_shortest_sleep() {
+  // The overhead already ate into the next boundary's wake, which is caught up on right away
+  int64_t nowUs = EPOCH_US + PERIOD_US - 100000;
+  uint64_t sleepUs = scheduleSleep(&schedule, nowUs);
+  TEST_ASSERT_TRUE(sleepUs == SCHEDULE_MIN_SLEEP_US);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == nowUs + SCHEDULE_MIN_SLEEP_US);
+}
+
+void test_first_wake_sets_the_overhead() {
+  schedule.wakeAtUs = EPOCH_US;
+  scheduleWake(&schedule, EPOCH_US + 200000);
+  TEST_ASSERT_EQUAL_UINT32(200000, schedule.overheadUs);
+  TEST_ASSERT_EQUAL_UINT32(0, schedule.jitterUs);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == 0);
+}
+
+void test_later_wakes_average_over_about_four() {
+  schedule.overheadUs = 200000;
+  schedule.wakeAtUs = EPOCH_US;
+  scheduleWake(&schedule, EPOCH_US + 280000);
+  TEST_ASSERT_EQUAL_UINT32(220000, schedule.overheadUs);
+  TEST_ASSERT_EQUAL_UINT32(20000, schedule.jitterUs);
+
+  // A faster wake pulls the overhead down, the jitter follows how far off it was either way
+  schedule.wakeAtUs = EPOCH_US + PERIOD_US;
+  scheduleWake(&schedule, EPOCH_US + PERIOD_US + 180000);
+  TEST_ASSERT_EQUAL_UINT32(210000, schedule.overheadUs);
+  TEST_ASSERT_EQUAL_UINT32(25000, schedule.jitterUs);
+}
+
+void test_wakes_too_far_off_are_ignored() {
+  schedule.overheadUs = 200000;
+  schedule.jitterUs = 5000;
+
+  schedule.wakeAtUs = EPOCH_US;
+  scheduleWake(&schedule, EPOCH_US + SCHEDULE_MAX_OVERHEAD_US + 1);
+  TEST_ASSERT_EQUAL_UINT32(200000, schedule.overheadUs);
+  TEST_ASSERT_EQUAL_UINT32(5000, schedule.jitterUs);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == 0);
+
+  // Before it was due, e.g. the button
+  schedule.wakeAtUs = EPOCH_US;
+  scheduleWake(&schedule, EPOCH_US - 1000);
+  TEST_ASSERT_EQUAL_UINT32(200000, schedule.overheadUs);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs == 0);
+
+  // The last sleep was not scheduled
+  scheduleWake(&schedule, EPOCH_US + 200000);
+  TEST_ASSERT_EQUAL_UINT32(200000, schedule.overheadUs);
+}
+
+void test_measured_overhead_lands_on_the_margin() {
+  // A wake that takes exactly the measured overhead reads the time SCHEDULE_MARGIN_US after the boundary
+  schedule.overheadUs = 400000;
+  int64_t nowUs = EPOCH_US + 30000000;
+  scheduleSleep(&schedule, nowUs);
+  scheduleWake(&schedule, schedule.wakeAtUs + 400000);
+  TEST_ASSERT_EQUAL_UINT32(400000, schedule.overheadUs);
+  TEST_ASSERT_EQUAL_UINT32(0, schedule.jitterUs);
+  scheduleSleep(&schedule, EPOCH_US + PERIOD_US + SCHEDULE_MARGIN_US + 100000);
+  TEST_ASSERT_TRUE(schedule.wakeAtUs + 400000 == EPOCH_US + 2 * PERIOD_US + SCHEDULE_MARGIN_US);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_sleeps_until_the_next_boundary);
+  RUN_TEST(test_on_a_boundary_sleeps_until_the_next_one);
+  RUN_TEST(test_adds_twice_the_jitter);
+  RUN_TEST(test_a_boundary_too_close_gets_the_shortest_sleep);
+  RUN_TEST(test_first_wake_sets_the_overhead);
+  RUN_TEST(test_later_wakes_average_over_about_four);
+  RUN_TEST(test_wakes_too_far_off_are_ignored);
+  RUN_TEST(test_measured_overhead_lands_on_the_margin);
+  return UNITY_END();
+}
@@ -0,0 +1,116 @@
+#include <unity.h>
+
+#include "lib/timeline.h"
+
+static TimelineLog timelines;
+
+// A complete wake of `type` that ran SETUP for `setupUs` and REFRESH for `refreshUs`, over `refreshCycles`
+static void addWake(uint8_t type, uint32_t setupUs, uint32_t refreshUs, uint32_t refreshCycles) {
+  timelineBegin(&timelines, type);
+  timelineEnd();
+  WakeTimeline &wake = timelines.types[type].wakes[(timelines.types[type].next + TIMELINE_WAKES - 1) % TIMELINE_WAKES];
+  wake.us[(uint8_t)Phase::SETUP] = setupUs;
+  wake.us[(uint8_t)Phase::REFRESH] = refreshUs;
+  wake.refreshCycles = refreshCycles;
+  wake.phases |= 1 << (uint8_t)Phase::REFRESH;
+}
+
+void setUp() { timelines = {}; }
+
+void tearDown() {}
+
+void test_begin_fills_the_ring_of_its_type() {
+  timelineBegin(&timelines, 1);
+  timelineMark(Phase::DRAW);
+  timelineEnd();
+  const TimelineRing &ring = timelines.types[1];
+  TEST_ASSERT_EQUAL_UINT8(1, ring.next);
+  TEST_ASSERT_EQUAL_UINT8(1, ring.count);
+  TEST_ASSERT_EQUAL_UINT8(0, timelines.types[0].count);
+  TEST_ASSERT_EQUAL_UINT32(1, ring.wakes[0].sequence);
+  TEST_ASSERT_EQUAL_UINT8(1, ring.wakes[0].wakeType);
+  TEST_ASSERT_TRUE(ring.wakes[0].complete);
+  uint8_t phases = (1 << (uint8_t)Phase::BOOT) | (1 << (uint8_t)Phase::SETUP) | (1 << (uint8_t)Phase::DRAW);
+  TEST_ASSERT_EQUAL_UINT8(phases, ring.wakes[0].phases);
+}
+
+void test_unknown_wake_type_is_not_recorded() {
+  timelineBegin(&timelines, TIMELINE_WAKE_TYPES);
+  timelineMark(Phase::DRAW);
+  timelineEnd();
+  TEST_ASSERT_EQUAL_UINT32(0, timelines.sequence);
+  for (uint8_t type = 0; type < TIMELINE_WAKE_TYPES; type++)
+    TEST_ASSERT_EQUAL_UINT8(0, timelines.types[type].count);
+}
+
+void test_full_ring_overwrites_the_oldest() {
+  for (uint8_t n = 0; n < TIMELINE_WAKES + 2; n++)
+    addWake(0, n, 0, 0);
+  const TimelineRing &ring = timelines.types[0];
+  TEST_ASSERT_EQUAL_UINT8(TIMELINE_WAKES, ring.count);
+  TEST_ASSERT_EQUAL_UINT8(2 % TIMELINE_WAKES, ring.next);
+  // Wakes 1 and 2 are gone, the slots they had hold the newest two
+  TEST_ASSERT_EQUAL_UINT32(TIMELINE_WAKES + 1, ring.wakes[0].sequence);
+  TEST_ASSERT_EQUAL_UINT32(TIMELINE_WAKES + 2, ring.wakes[1].sequence);
+  TEST_ASSERT_EQUAL_UINT32(3, ring.wakes[2].sequence);
+}
+
+void test_order_merges_the_rings_by_sequence() {
+  // Minute wakes overwrite their own ring, the full wake in between stays
+  addWake(0, 0, 0, 0);
+  addWake(2, 0, 0, 0);
+  for (uint8_t n = 0; n < TIMELINE_WAKES + 1; n++)
+    addWake(1, 0, 0, 0);
+  addWake(0, 0, 0, 0);
+
+  const WakeTimeline *wakes[TIMELINE_WAKE_TYPES * TIMELINE_WAKES];
+  uint8_t count = timelineOrder(timelines, wakes);
+  TEST_ASSERT_EQUAL_UINT8(3 + TIMELINE_WAKES, count);
+  TEST_ASSERT_EQUAL_UINT32(1, wakes[0]->sequence);
+  TEST_ASSERT_EQUAL_UINT32(2, wakes[1]->sequence);
+  for (uint8_t n = 2; n < count; n++)
+    TEST_ASSERT_EQUAL_UINT32(wakes[n - 1]->sequence + (n == 2 ? 2 : 1), wakes[n]->sequence);
+  TEST_ASSERT_EQUAL_UINT8(0, wakes[count - 1]->wakeType);
+}
+
+void test_stats_are_min_avg_max_of_complete_wakes() {
+  addWake(1, 100, 4000, 80000);
+  addWake(1, 300, 2000, 40000);
+  addWake(1, 200, 3000, 60000);
+  // Never reached deep sleep
+  addWake(1, 9999, 9999, 0);
+  timelines.types[1].wakes[3].complete = false;
+
+  PhaseStats setup = timelineStats(timelines.types[1], Phase::SETUP);
+  TEST_ASSERT_EQUAL_UINT8(3, setup.wakes);
+  TEST_ASSERT_EQUAL_UINT32(100, setup.minUs);
+  TEST_ASSERT_EQUAL_UINT32(200, setup.avgUs);
+  TEST_ASSERT_EQUAL_UINT32(300, setup.maxUs);
+  TEST_ASSERT_EQUAL_UINT32(0, setup.avgCycles);
+
+  PhaseStats refresh = timelineStats(timelines.types[1], Phase::REFRESH);
+  TEST_ASSERT_EQUAL_UINT8(3, refresh.wakes);
+  TEST_ASSERT_EQUAL_UINT32(2000, refresh.minUs);
+  TEST_ASSERT_EQUAL_UINT32(3000, refresh.avgUs);
+  TEST_ASSERT_EQUAL_UINT32(4000, refresh.maxUs);
+  TEST_ASSERT_EQUAL_UINT32(60000, refresh.avgCycles);
+}
+
+void test_stats_skip_phases_that_didnt_run() {
+  addWake(2, 100, 0, 0);
+  PhaseStats draw = timelineStats(timelines.types[2], Phase::DRAW);
+  TEST_ASSERT_EQUAL_UINT8(0, draw.wakes);
+  TEST_ASSERT_EQUAL_UINT32(0, draw.minUs);
+  TEST_ASSERT_EQUAL_UINT8(0, timelineStats(timelines.types[0], Phase::SETUP).wakes);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_begin_fills_the_ring_of_its_type);
+  RUN_TEST(test_unknown_wake_type_is_not_recorded);
+  RUN_TEST(test_full_ring_overwrites_the_oldest);
+  RUN_TEST(test_order_merges_the_rings_by_sequence);
+  RUN_TEST(test_stats_are_min_avg_max_of_complete_wakes);
+  RUN_TEST(test_stats_skip_phases_that_didnt_run);
+  return UNITY_END();
+}
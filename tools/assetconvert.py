@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Converts PNG images into 1-bpp Asset headers for the firmware (see src/lib/asset.h).
+
+Dark, opaque pixels become set bits, which drawAsset() draws in the given color. Images can be
+pre-rotated for a display rotation so the firmware blits them in panel order, and run-length
+encoded with the same run format as GFXFONT_RLE fonts. Each image becomes one Asset named after
+its file. Flash sizes before (plain drawBitmap() arrays) and after are reported on stderr.
+
+Example, for the watch faces drawn with setRotation(1):
+  python3 tools/assetconvert.py --rotate 1 --rle -o src/resources/icons.h assets/icons/ui/*.png
+
+Only the Python standard library is needed; interlaced PNGs are not supported.
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    """Returns (width, height, rows) with rows as lists of booleans, True for a set pixel."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG file" % path)
+
+    pos, idat, palette, transparency = 8, b"", None, None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        chunk = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i : i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            transparency = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    if interlace:
+        raise ValueError("%s: interlaced PNGs are not supported" % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(1, bits_per_pixel // 8)
+    raw = zlib.decompress(idat)
+
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        offset = y * (stride + 1)
+        kind, line = raw[offset], bytearray(raw[offset + 1 : offset + 1 + stride])
+        for i in range(stride):
+            a = line[i - step] if i >= step else 0
+            b = prev[i]
+            c = prev[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+
+        samples = []
+        if depth < 8:
+            for i in range(width * channels):
+                shift = 8 - depth - (i * depth) % 8
+                samples.append((line[i * depth // 8] >> shift) & ((1 << depth) - 1))
+            samples = [s * 255 // ((1 << depth) - 1) if color != 3 else s for s in samples]
+        else:
+            size = depth // 8
+            for i in range(width * channels):
+                samples.append(line[i * size])  # High byte of 16-bit samples
+
+        row = []
+        for x in range(width):
+            px = samples[x * channels : (x + 1) * channels]
+            alpha = 255
+            if color == 3:
+                index = px[0]
+                r, g, b = palette[index]
+                if transparency and index < len(transparency):
+                    alpha = transparency[index]
+            elif color in (0, 4):
+                r = g = b = px[0]
+                if color == 4:
+                    alpha = px[1]
+            else:
+                r, g, b = px[:3]
+                if color == 6:
+                    alpha = px[3]
+            luma = (r * 299 + g * 587 + b * 114) // 1000
+            row.append(alpha >= 128 and luma < 128)
+        rows.append(row)
+    return width, height, rows
+
+
+def rotate(rows, rotation):
+    """Rotates clockwise by 90 degrees `rotation` times, which is how setRotation() lays pixels out on the panel."""
+    for _ in range(rotation & 3):
+        rows = [list(col) for col in zip(*rows[::-1])]
+    return rows
+
+
+def pack_raw(rows):
+    out = bytearray()
+    for row in rows:
+        for i in range(0, len(row), 8):
+            byte = 0
+            for bit, on in enumerate(row[i : i + 8]):
+                if on:
+                    byte |= 0x80 >> bit
+            out.append(byte)
+    return out
+
+
+def pack_rle(rows):
+    out, on, run = bytearray(), False, 0
+    for row in rows:
+        for pixel in row:
+            if pixel != on:
+                out += encode_run(run)
+                on, run = pixel, 0
+            run += 1
+    out += encode_run(run)
+    return out
+
+
+def encode_run(length):
+    out = bytearray()
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+    return out
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i : i + 16]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("images", nargs="+", help="PNG files, the file name (minus extension) becomes the Asset name")
+    parser.add_argument("-o", "--output", required=True, help="header to write")
+    parser.add_argument("--rotate", type=int, choices=range(4), help="pre-rotate for this display rotation")
+    parser.add_argument("--rle", action="store_true", help="run-length encode assets where that is smaller")
+    args = parser.parse_args()
+
+    # Record the command line, with a glob in place of a whole directory of images
+    command = ["python3", "tools/assetconvert.py"] + sys.argv[1 : len(sys.argv) - len(args.images)]
+    folders = {os.path.dirname(path) for path in args.images}
+    pattern = os.path.join(folders.pop(), "*.png") if len(folders) == 1 else None
+    if pattern and sorted(glob.glob(pattern)) == sorted(args.images):
+        command.append(pattern)
+    else:
+        command += args.images
+
+    out = [
+        "#pragma once",
+        "",
+        "// Generated by tools/assetconvert.py, do not edit. Regenerate with:",
+        "// %s" % " ".join(command),
+        "",
+        '#include "lib/asset.h"',
+    ]
+    total_before = total_after = 0
+    for path in args.images:
+        name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+        width, height, rows = read_png(path)
+        before = len(pack_raw(rows))
+
+        native = args.rotate is not None
+        stored = rotate(rows, args.rotate) if native else rows
+        data, encoding = pack_raw(stored), "RAW"
+        if args.rle:
+            rle = pack_rle(stored)
+            if len(rle) < len(data):
+                data, encoding = rle, "RLE"
+
+        out += [
+            "",
+            "const uint8_t %s_data[] PROGMEM = {\n%s};" % (name, format_bytes(data)),
+            "const Asset %s = {%s_data, %d, %d, AssetEncoding::%s, %s, %d};"
+            % (name, name, width, height, encoding, "true" if native else "false", args.rotate or 0),
+        ]
+        total_before += before
+        total_after += len(data)
+        sys.stderr.write("%-32s %4dx%-4d %s %5d -> %5d bytes\n" % (name, width, height, encoding, before, len(data)))
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+    sys.stderr.write("%-32s %14s %5d -> %5d bytes\n" % ("total", "", total_before, total_after))
+
+
+if __name__ == "__main__":
+    main()